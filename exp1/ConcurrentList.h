@@ -0,0 +1,188 @@
+#ifndef CONCURRENT_LIST_H
+#define CONCURRENT_LIST_H
+#include <iostream>
+#include <cstdlib>
+#include <atomic>
+#include <mutex>
+using namespace std;
+
+// 线程安全的单向链表（惰性链表）：读者完全不加锁，写者只锁定待修改的一两个节点
+// 读者（find/traverse）沿succ直接前进，跳过已标记删除的节点，途中不做任何原子读改写
+// 写者先不加锁地定位，再锁定前驱（及当前节点）并校验二者仍未被删除、前驱仍指向当前节点，校验失败则重试
+// 删除先置marked（逻辑删除）再摘链（物理删除）；存活节点只指向存活节点，故已摘链的节点不会再被新操作访问
+// 节点间的相对次序从不改变，写者总按链表次序加锁，故无死锁
+// 回收：摘下的节点先入待回收链表；每个操作进出时各对_active做一次加减，
+//       某操作结束时若观察到_active为0，则此前摘下的节点已无任何线程可能访问，随即释放
+//       （持续不断的并发访问下待回收节点会暂时积压，至多保留到析构）
+template <typename T> class ConcurrentList {
+private:
+    struct Node {
+        T data;                 // 构造后不再修改，读者无需加锁
+        atomic<Node*> succ;
+        atomic<bool> marked;    // 已逻辑删除
+        Node* retiredNext;      // 待回收链表（另设字段，以免改写读者可能仍在沿用的succ）
+        mutex lock;             // 写者修改succ/marked时持有
+
+        Node() : succ(nullptr), marked(false), retiredNext(nullptr) {} // 针对头哨兵的构造
+        Node(T const& e, Node* s = nullptr) : data(e), succ(s), marked(false), retiredNext(nullptr) {}
+    };
+
+    Node* head;                   // 头哨兵
+    atomic<int> _size;
+    mutable atomic<int> _active;  // 进行中的操作数
+    mutable mutex _retireLock;
+    mutable Node* _retired;       // 已摘链、待回收的节点
+
+    // 操作守卫：构造时登记、析构时注销，并伺机回收
+    struct Guard {
+        ConcurrentList const* list;
+        Guard(ConcurrentList const* l) : list(l) { list->_active.fetch_add(1, memory_order_seq_cst); }
+        ~Guard() {
+            if (list->_active.fetch_sub(1, memory_order_seq_cst) == 1) list->reclaim();
+        }
+    };
+
+    // 将已摘链的x记入待回收链表
+    void retire(Node* x) {
+        lock_guard<mutex> g(_retireLock);
+        x->retiredNext = _retired;
+        _retired = x;
+    }
+
+    // 若此刻无进行中的操作，释放全部待回收节点（先取链表、后查_active，故取到的节点均早已摘链）
+    void reclaim() const {
+        unique_lock<mutex> g(_retireLock, try_to_lock);
+        if (!g.owns_lock() || !_retired) return;
+        Node* x = _retired;
+        if (_active.load(memory_order_seq_cst) != 0) return;
+        _retired = nullptr;
+        g.unlock();
+        while (x) {
+            Node* next = x->retiredNext;
+            delete x;
+            x = next;
+        }
+    }
+
+    // 不加锁地定位首个未删除且等于e的节点，pred带回其前驱；找不到则返回nullptr
+    Node* locate(T const& e, Node*& pred) const {
+        pred = head;
+        for (Node* curr = head->succ.load(memory_order_acquire); curr; curr = curr->succ.load(memory_order_acquire)) {
+            if (curr->data == e && !curr->marked.load(memory_order_acquire)) return curr;
+            pred = curr;
+        }
+        return nullptr;
+    }
+
+    // 在已锁定的pred之后摘除已锁定的curr
+    void unlink(Node* pred, Node* curr) {
+        curr->marked.store(true, memory_order_release);
+        pred->succ.store(curr->succ.load(memory_order_relaxed), memory_order_seq_cst);
+        _size--;
+        retire(curr);
+    }
+
+    ConcurrentList(ConcurrentList<T> const&);            // 禁止复制
+    ConcurrentList<T>& operator=(ConcurrentList<T> const&);
+
+public:
+    // 构造函数
+    ConcurrentList() : head(new Node), _size(0), _active(0), _retired(nullptr) {}
+
+    // 析构函数（须确保已无其他线程访问）
+    ~ConcurrentList() {
+        for (Node* x = head; x; ) {
+            Node* next = x->succ.load(memory_order_relaxed);
+            delete x;
+            x = next;
+        }
+        for (Node* x = _retired; x; ) {
+            Node* next = x->retiredNext;
+            delete x;
+            x = next;
+        }
+    }
+
+    int size() const { return _size.load(); }
+    bool empty() const { return size() == 0; }
+
+    // 插入为首节点
+    void insertFirst(T const& e) {
+        Guard guard(this);
+        lock_guard<mutex> g(head->lock);
+        head->succ.store(new Node(e, head->succ.load(memory_order_relaxed)), memory_order_release);
+        _size++;
+    }
+
+    // 在首个等于pos的节点之后插入e；找不到pos则返回false
+    bool insertAfter(T const& pos, T const& e) {
+        Guard guard(this);
+        for (;;) {
+            Node* pred;
+            Node* curr = locate(pos, pred);
+            if (!curr) return false;
+            lock_guard<mutex> g(curr->lock);
+            if (curr->marked.load(memory_order_relaxed)) continue; // 定位后被删除，重试
+            curr->succ.store(new Node(e, curr->succ.load(memory_order_relaxed)), memory_order_release);
+            _size++;
+            return true;
+        }
+    }
+
+    // 删除首个等于e的节点；找不到则返回false
+    bool remove(T const& e) {
+        Guard guard(this);
+        for (;;) {
+            Node* pred;
+            Node* curr = locate(e, pred);
+            if (!curr) return false;
+            lock_guard<mutex> gp(pred->lock);
+            lock_guard<mutex> gc(curr->lock);
+            if (pred->marked.load(memory_order_relaxed) || curr->marked.load(memory_order_relaxed)
+                || pred->succ.load(memory_order_relaxed) != curr) continue; // 校验失败，重试
+            unlink(pred, curr);
+            return true;
+        }
+    }
+
+    // 查找：是否存在等于e的节点（不加锁）
+    bool find(T const& e) const {
+        Guard guard(this);
+        Node* pred;
+        return locate(e, pred) != nullptr;
+    }
+
+    // 遍历（不加锁，跳过已删除的节点；与写者并发时看到的是某种交错下的状态）
+    template <typename VST> void traverse(VST& visit) const {
+        Guard guard(this);
+        for (Node* curr = head->succ.load(memory_order_acquire); curr; curr = curr->succ.load(memory_order_acquire))
+            if (!curr->marked.load(memory_order_acquire)) visit(curr->data);
+    }
+    void traverse(void (*visit)(T const&)) const { traverse<void (*)(T const&)>(visit); }
+
+    // 清空列表：逐个摘除首节点
+    int clear() {
+        Guard guard(this);
+        int n = 0;
+        for (;;) {
+            lock_guard<mutex> gp(head->lock);
+            Node* x = head->succ.load(memory_order_relaxed);
+            if (!x) break;
+            lock_guard<mutex> gc(x->lock); // 存活节点只被存活节点指向，x必未删除
+            unlink(head, x);
+            n++;
+        }
+        return n;
+    }
+
+    // 遍历输出（从首到尾）
+    void print() const {
+        struct Printer { void operator()(T const& e) const { cout << e << " "; } } p;
+        traverse(p);
+        cout << endl;
+    }
+};
+
+
+
+#endif  // CONCURRENT_LIST_H
@@ -0,0 +1,198 @@
+#ifndef CONCURRENT_STACK_H
+#define CONCURRENT_STACK_H
+#include <iostream>
+#include <cstdlib>
+#include <atomic>
+#include <algorithm>
+using namespace std;
+
+// 无锁栈（Treiber算法）：栈顶以CAS更新，多生产者/多消费者均无需加锁
+// 节点回收（风险指针）：出栈线程读取栈顶节点前先将其登记为风险指针，并复核其仍为栈顶；
+//   出栈的节点先记入退休链表，待退休数超过阈值时扫描全部风险指针，未被任何线程登记者才真正释放
+//   已登记的节点不会被释放，其地址也就不会被复用，故CAS不会遭遇ABA问题，亦无需版本号
+// 风险记录按栈分配、只增不减，各操作临时占用一个（数目不超过同时访问的线程数）；
+//   每个记录上至多滞留约2H + RETIRE_BATCH个待释放节点（H为记录数），析构时统一释放
+template <typename T> class ConcurrentStack {
+private:
+    struct Node {
+        T data;
+        Node* next;         // 入栈前写定，此后不再修改
+        Node* retiredNext;  // 退休链表（另设字段，以免改写其他线程可能仍在读取的next）
+
+        Node(T const& e) : data(e), next(nullptr), retiredNext(nullptr) {}
+    };
+
+    // 风险记录：hazard为持有者正在访问的节点；退休链表随记录一同转交，仅由当前持有者访问
+    struct HazardRecord {
+        atomic<Node*> hazard;
+        atomic<bool> active;
+        HazardRecord* next;  // 记录链表（只在表头插入，插入后不再修改）
+        Node* retired;
+        int retiredCount;
+
+        HazardRecord() : hazard(nullptr), active(true), next(nullptr), retired(nullptr), retiredCount(0) {}
+    };
+
+    static const int RETIRE_BATCH = 64;
+
+    atomic<Node*> top;                // 栈顶
+    atomic<HazardRecord*> records;    // 风险记录链表
+    atomic<int> recordCount;
+    atomic<int> _size;                // 规模（并发时仅为近似值）
+
+    // 占用一个空闲的风险记录，没有则新建并插入表头
+    HazardRecord* acquireRecord() {
+        for (HazardRecord* r = records.load(memory_order_acquire); r; r = r->next)
+            if (!r->active.load(memory_order_relaxed) && !r->active.exchange(true, memory_order_acquire))
+                return r;
+        HazardRecord* r = new HazardRecord;
+        HazardRecord* old = records.load(memory_order_relaxed);
+        do {
+            r->next = old;
+        } while (!records.compare_exchange_weak(old, r, memory_order_seq_cst, memory_order_relaxed));
+        recordCount.fetch_add(1, memory_order_relaxed);
+        return r;
+    }
+
+    void releaseRecord(HazardRecord* r) {
+        r->hazard.store(nullptr, memory_order_release);
+        r->active.store(false, memory_order_release);
+    }
+
+    // 退休节点x，退休链表足够长时扫描回收
+    void retire(HazardRecord* r, Node* x) {
+        x->retiredNext = r->retired;
+        r->retired = x;
+        if (++r->retiredCount >= 2 * recordCount.load(memory_order_relaxed) + RETIRE_BATCH) scan(r);
+    }
+
+    // 收集全部风险指针，释放r的退休链表中未被登记的节点
+    // 扫描之后才加入的记录无需考虑：其登记的节点已不在栈中，复核必然失败
+    void scan(HazardRecord* r) {
+        int n = 0;
+        HazardRecord* head = records.load(memory_order_seq_cst);
+        for (HazardRecord* h = head; h; h = h->next) n++;
+        Node** hazards = new Node*[n];
+        int m = 0;
+        for (HazardRecord* h = head; h; h = h->next)
+            if (Node* p = h->hazard.load(memory_order_seq_cst)) hazards[m++] = p;
+        sort(hazards, hazards + m);
+        Node* x = r->retired;
+        r->retired = nullptr;
+        r->retiredCount = 0;
+        while (x) {
+            Node* next = x->retiredNext;
+            if (binary_search(hazards, hazards + m, x)) { // 仍被登记，留待下次扫描
+                x->retiredNext = r->retired;
+                r->retired = x;
+                r->retiredCount++;
+            } else {
+                delete x;
+            }
+            x = next;
+        }
+        delete[] hazards;
+    }
+
+    // 释放以next（或retiredNext）串起的单向链表上的全部节点
+    static void destroy(Node* p, bool retiredList) {
+        while (p) {
+            Node* x = p;
+            p = retiredList ? p->retiredNext : p->next;
+            delete x;
+        }
+    }
+
+    // 将以first为首、last为尾的一串节点整体压入栈顶，一次CAS完成
+    void pushChain(Node* first, Node* last) {
+        Node* old = top.load(memory_order_relaxed);
+        do {
+            last->next = old;
+        } while (!top.compare_exchange_weak(old, first, memory_order_release, memory_order_relaxed));
+    }
+
+    ConcurrentStack(ConcurrentStack<T> const&);            // 禁止复制
+    ConcurrentStack<T>& operator=(ConcurrentStack<T> const&);
+
+public:
+    // 构造函数
+    ConcurrentStack() : top(nullptr), records(nullptr), recordCount(0), _size(0) {}
+
+    // 析构函数（须确保已无其他线程访问）
+    ~ConcurrentStack() {
+        destroy(top.load(), false);
+        HazardRecord* r = records.load();
+        while (r) {
+            HazardRecord* next = r->next;
+            destroy(r->retired, true);
+            delete r;
+            r = next;
+        }
+    }
+
+    int size() const { return _size.load(memory_order_relaxed); }
+    bool empty() const { return top.load(memory_order_acquire) == nullptr; }
+
+    // 入栈
+    void push(T const& e) {
+        Node* x = new Node(e);
+        pushChain(x, x);
+        _size.fetch_add(1, memory_order_relaxed);
+    }
+
+    // 出栈：成功则将栈顶元素存入e并返回true，栈空则返回false
+    bool pop(T& e) {
+        HazardRecord* r = acquireRecord();
+        Node* p = top.load(memory_order_acquire);
+        while (p) {
+            r->hazard.store(p, memory_order_seq_cst);      // 先登记
+            Node* q = top.load(memory_order_seq_cst);      // 再复核：p仍为栈顶，则此后不会被释放
+            if (q != p) { p = q; continue; }
+            if (top.compare_exchange_strong(p, p->next, memory_order_seq_cst, memory_order_acquire)) break;
+        }
+        r->hazard.store(nullptr, memory_order_release);
+        if (p) {
+            _size.fetch_sub(1, memory_order_relaxed);
+            e = p->data;
+            retire(r, p);
+        }
+        releaseRecord(r);
+        return p != nullptr;
+    }
+
+    // 批量入栈：A[0..n)依次入栈（A[n-1]位于栈顶），整批一次CAS接入，其间不会与其他元素交错
+    void pushAll(T const* A, int n) {
+        if (n < 1) return;
+        Node* last = new Node(A[0]);
+        Node* first = last;
+        for (int i = 1; i < n; i++) {
+            Node* x = new Node(A[i]);
+            x->next = first;
+            first = x;
+        }
+        pushChain(first, last);
+        _size.fetch_add(n, memory_order_relaxed);
+    }
+
+    // 批量出栈：一次交换摘下整个栈，自栈顶到栈底逐个交由visit处理，返回元素个数
+    // 摘下的节点同样经退休链表回收（其他线程可能仍登记着原栈顶）
+    template <typename VST> int popAll(VST& visit) {
+        Node* first = top.exchange(nullptr, memory_order_seq_cst);
+        if (!first) return 0;
+        int n = 0;
+        for (Node* p = first; p; p = p->next, n++) visit(p->data);
+        _size.fetch_sub(n, memory_order_relaxed);
+        HazardRecord* r = acquireRecord();
+        for (Node* p = first; p; ) {
+            Node* next = p->next;
+            retire(r, p);
+            p = next;
+        }
+        releaseRecord(r);
+        return n;
+    }
+};
+
+
+
+#endif  // CONCURRENT_STACK_H
@@ -0,0 +1,222 @@
+#ifndef FORK_JOIN_POOL_H
+#define FORK_JOIN_POOL_H
+#include <iostream>
+#include <cstdlib>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <thread>
+#include <chrono>
+#include <exception>
+#include "WorkStealingDeque.h"
+using namespace std;
+
+// 任务组：记录尚未完成的子任务数，供wait等待；子任务抛出的首个异常保存于此，由wait重新抛出
+class TaskGroup {
+    friend class ForkJoinPool;
+    atomic<int> pending;
+    atomic<bool> failed;
+    exception_ptr error; // 由首个失败的子任务写入，pending归零后对wait可见
+public:
+    TaskGroup() : pending(0), failed(false) {}
+};
+
+// 简易fork-join调度器：每个工作线程拥有一个WorkStealingDeque
+// spawn将子任务压入本线程队列底端，wait期间本线程先执行自己的任务，再随机窃取其他线程的任务
+// 用法：
+//   ForkJoinPool pool(4);
+//   pool.invoke([&] { pool.join([&] { 左半递归 }, [&] { 右半递归 }); });
+// 递归中须自行设定粒度（规模小于阈值时改为串行），否则任务开销将超过收益
+// 空闲的后台线程先让出若干次CPU，仍无任务则休眠，待spawn唤醒（或超时后再试）
+// 子任务抛出的异常在wait（及join）中重新抛出，f抛出的异常由invoke传给调用者
+class ForkJoinPool {
+private:
+    struct Task {
+        function<void()> fn;
+        TaskGroup* group;
+    };
+    struct Slot { ForkJoinPool* pool; int index; }; // 当前线程所属的调度器及工作线程编号
+
+    int _n;                               // 工作线程数（含invoke的调用者，其编号为0）
+    WorkStealingDeque<Task*>* _deques;    // 各工作线程的任务队列
+    thread* _threads;                     // 编号1.._n-1的后台线程
+    atomic<bool> _stop;
+    atomic<int> _active;                  // 正在执行的invoke数（为0时后台线程休眠）
+    atomic<int> _sleeping;                // 因无任务可窃而休眠的后台线程数
+    unsigned _signals;                    // spawn唤醒休眠线程的次数（受_lock保护）
+    mutex _lock, _invokeLock;
+    condition_variable _wakeup;           // invoke开始或调度器析构
+    condition_variable _idle;             // 有新任务派生
+
+    static const int SPINS = 64;          // 休眠前连续落空的次数
+    static const int PARK_MS = 1;         // 休眠的最长时间（毫秒），以防错过唤醒
+
+    static Slot& current() {
+        static thread_local Slot s = { nullptr, -1 };
+        return s;
+    }
+
+    // 执行任务并通知其所属任务组；任务抛出的异常记入任务组，不影响其他任务
+    static void execute(Task* t) {
+        TaskGroup* g = t->group;
+        try {
+            t->fn();
+        } catch (...) {
+            if (!g->failed.exchange(true, memory_order_relaxed)) g->error = current_exception();
+        }
+        delete t;
+        g->pending.fetch_sub(1, memory_order_release);
+    }
+
+    // 等待任务组全部完成（不抛出异常）；等待期间协助执行其他任务
+    void help(TaskGroup& g) {
+        Slot& s = current();
+        while (g.pending.load(memory_order_acquire) > 0)
+            if (s.pool != this || !runOne(s.index)) this_thread::yield();
+    }
+
+    // 休眠至spawn唤醒、invoke全部结束、调度器析构或超时
+    void park() {
+        unique_lock<mutex> lk(_lock);
+        unsigned signals = _signals;
+        _sleeping.fetch_add(1, memory_order_seq_cst);
+        _idle.wait_for(lk, chrono::milliseconds((long long)PARK_MS), [&] {
+            return _signals != signals || _stop.load() || _active.load() == 0;
+        });
+        _sleeping.fetch_sub(1, memory_order_relaxed);
+    }
+
+    // 执行一个任务：优先取自己队列底端，否则自随机起点依次窃取；无任务可做则返回false
+    bool runOne(int i) {
+        Task* t;
+        if (_deques[i].take(t)) { execute(t); return true; }
+        static thread_local unsigned seed = (unsigned)(size_t)&seed;
+        seed = seed * 1103515245 + 12345;
+        int start = (int)((seed >> 16) % _n);
+        for (int k = 0; k < _n; k++) {
+            int v = (start + k) % _n;
+            if (v != i && _deques[v].steal(t)) { execute(t); return true; }
+        }
+        return false;
+    }
+
+    void workerLoop(int i) {
+        current().pool = this;
+        current().index = i;
+        for (;;) {
+            {
+                unique_lock<mutex> lk(_lock);
+                _wakeup.wait(lk, [&] { return _stop.load() || _active.load() > 0; });
+            }
+            if (_stop.load()) return;
+            int misses = 0;
+            while (_active.load(memory_order_relaxed) > 0 && !_stop.load(memory_order_relaxed)) {
+                if (runOne(i)) misses = 0;
+                else if (++misses < SPINS) this_thread::yield();
+                else { park(); misses = 0; }
+            }
+        }
+    }
+
+    ForkJoinPool(ForkJoinPool const&);            // 禁止复制
+    ForkJoinPool& operator=(ForkJoinPool const&);
+
+public:
+    // 构造函数：n为工作线程总数（默认取硬件线程数）
+    explicit ForkJoinPool(int n = (int)thread::hardware_concurrency())
+        : _stop(false), _active(0), _sleeping(0), _signals(0) {
+        _n = n < 1 ? 1 : n;
+        _deques = new WorkStealingDeque<Task*>[_n];
+        _threads = new thread[_n - 1];
+        for (int i = 1; i < _n; i++) _threads[i - 1] = thread(&ForkJoinPool::workerLoop, this, i);
+    }
+
+    // 析构函数：通知并等待后台线程退出
+    ~ForkJoinPool() {
+        {
+            lock_guard<mutex> g(_lock);
+            _stop.store(true);
+        }
+        _wakeup.notify_all();
+        _idle.notify_all();
+        for (int i = 0; i < _n - 1; i++) _threads[i].join();
+        delete[] _threads;
+        delete[] _deques;
+    }
+
+    int workers() const { return _n; }
+
+    // 在调度器中执行f（调用者作为0号工作线程参与），f返回即结束；同一时刻仅允许一个外部调用者
+    // f抛出的异常在恢复调度器状态后传给调用者
+    template <typename F> void invoke(F&& f) {
+        Slot& s = current();
+        if (s.pool == this) { f(); return; }
+        lock_guard<mutex> g(_invokeLock);
+        Slot saved = s;
+        s.pool = this;
+        s.index = 0;
+        {
+            lock_guard<mutex> lk(_lock);
+            _active.fetch_add(1);
+        }
+        _wakeup.notify_all();
+        try {
+            f();
+        } catch (...) {
+            _active.fetch_sub(1);
+            s = saved;
+            throw;
+        }
+        _active.fetch_sub(1);
+        s = saved;
+    }
+
+    // 派生子任务（仅在本调度器的工作线程中有效，否则直接串行执行）
+    template <typename F> void spawn(TaskGroup& g, F&& f) {
+        Slot& s = current();
+        if (s.pool != this) { f(); return; }
+        g.pending.fetch_add(1, memory_order_relaxed);
+        Task* t = new Task;
+        t->fn = std::forward<F>(f);
+        t->group = &g;
+        _deques[s.index].push(t);
+        if (_sleeping.load(memory_order_seq_cst) > 0) { // 唤醒一个休眠线程来窃取
+            {
+                lock_guard<mutex> lk(_lock);
+                _signals++;
+            }
+            _idle.notify_one();
+        }
+    }
+
+    // 等待任务组全部完成；等待期间协助执行其他任务
+    // 若有子任务抛出异常，全部完成后重新抛出其中首个（并清除，任务组可继续使用）
+    void wait(TaskGroup& g) {
+        help(g);
+        if (g.failed.load(memory_order_relaxed)) {
+            exception_ptr e = g.error;
+            g.error = nullptr;
+            g.failed.store(false, memory_order_relaxed);
+            rethrow_exception(e);
+        }
+    }
+
+    // 并行执行a与b：b作为子任务派生，a由当前线程执行，二者均完成后返回
+    // a抛出异常时仍先等待b结束（b可能引用调用者的栈帧），再传出a的异常
+    template <typename A, typename B> void join(A&& a, B&& b) {
+        TaskGroup g;
+        spawn(g, std::forward<B>(b));
+        try {
+            a();
+        } catch (...) {
+            help(g);
+            throw;
+        }
+        wait(g);
+    }
+};
+
+
+
+#endif  // FORK_JOIN_POOL_H
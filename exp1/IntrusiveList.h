@@ -0,0 +1,164 @@
+#ifndef INTRUSIVE_LIST_H
+#define INTRUSIVE_LIST_H
+#include <iostream>
+#include <cstdlib>
+#include <cstddef>
+#include "List.h" //Rank
+using namespace std;
+
+struct ListHook { //侵入式链表的链接域：嵌入用户对象之中，一个对象可含多个ListHook以同时属于多个列表
+   ListHook* pred; ListHook* succ; //前驱、后继
+   ListHook() : pred( NULL ), succ( NULL ) {}
+   bool linked() const { return pred != NULL; } //是否已挂在某个列表中
+};
+
+//侵入式双向链表：不复制、不分配，仅将对象中的Hook链入；对象的生命周期由使用者负责
+//用法：struct Item { int key; ListHook byKey; }; IntrusiveList<Item, &Item::byKey> L;
+template <typename T, ListHook T::*Hook> class IntrusiveList {
+private:
+   Rank _size; // 规模
+   ListHook header, trailer; // 头、尾哨兵（内嵌于列表对象，故列表不可复制）
+
+   static ListHook* hook( T& e ) { return &( e.*Hook ); } //对象 -> 链接域
+   static size_t hookOffset() { //Hook在T中的字节偏移：借一块未构造T的静态存储求成员地址（不解引用空指针）
+      union Probe { char c; T obj; Probe() {} ~Probe() {} };
+      static Probe probe;
+      static size_t offset = reinterpret_cast<char*>( &( probe.obj.*Hook ) ) - reinterpret_cast<char*>( &probe.obj );
+      return offset;
+   }
+   static T* owner( ListHook* h ) //链接域 -> 对象（按成员偏移回推）
+   {  return reinterpret_cast<T*>( reinterpret_cast<char*>( h ) - hookOffset() );  }
+   static void linkBefore( ListHook* x, ListHook* p ) //将x接入p之前
+   {  x->pred = p->pred; x->succ = p; p->pred->succ = x; p->pred = x;  }
+   static ListHook* mergeRuns( ListHook* a, ListHook* b ); //归并两个以succ单链、NULL结尾的有序段
+
+   IntrusiveList( IntrusiveList const& ); //禁止复制
+   IntrusiveList& operator=( IntrusiveList const& );
+
+public:
+   // 构造与析构
+   IntrusiveList() : _size( 0 ) { header.succ = &trailer; trailer.pred = &header; }
+   ~IntrusiveList() { clear(); } //仅摘除，不释放对象
+
+   // 访问操作
+   Rank size() const { return _size; }
+   bool empty() const { return _size == 0; }
+   T* first() const { return empty() ? NULL : owner( header.succ ); } //首对象（空表为NULL）
+   T* last() const { return empty() ? NULL : owner( trailer.pred ); } //末对象（空表为NULL）
+   T* succ( T* p ) const { ListHook* h = hook( *p )->succ; return ( h == &trailer ) ? NULL : owner( h ); } //后继（无则NULL）
+   T* pred( T* p ) const { ListHook* h = hook( *p )->pred; return ( h == &header ) ? NULL : owner( h ); } //前驱（无则NULL）
+
+   // 插入操作（e须尚未挂在本Hook对应的任何列表中）
+   T* insertFirst( T& e ) { linkBefore( hook( e ), header.succ ); _size++; return &e; }
+   T* insertLast( T& e ) { linkBefore( hook( e ), &trailer ); _size++; return &e; }
+   T* insert( T* p, T& e ) { linkBefore( hook( e ), hook( *p )->succ ); _size++; return &e; } //e作为p的后继
+   T* insert( T& e, T* p ) { linkBefore( hook( e ), hook( *p ) ); _size++; return &e; } //e作为p的前驱
+
+   // 删除操作（仅摘除，不释放）
+   T* remove( T* p );
+   Rank clear();
+
+   // 查找与去重
+   T* find( T const& e ) const; //无序查找：返回首个等于e者，无则NULL
+   Rank dedup(); //无序去重（摘除后出现的重复者）
+   Rank uniquify(); //有序去重
+
+   // 排序
+   void sort(); //自底向上归并排序（稳定，仅重连链接域）
+
+   // 遍历
+   void traverse( void ( *visit )( T& ) );
+   template <typename VST> void traverse( VST& visit );
+
+   void print() const {
+      for ( ListHook* h = header.succ; h != &trailer; h = h->succ ) cout << *owner( h ) << " ";
+      cout << endl;
+   }
+};
+
+template <typename T, ListHook T::*Hook> //将p自本列表摘除（p须属于本列表），返回p
+T* IntrusiveList<T, Hook>::remove( T* p ) {
+   ListHook* h = hook( *p );
+   h->pred->succ = h->succ; h->succ->pred = h->pred;
+   h->pred = h->succ = NULL; _size--;
+   return p;
+}
+
+template <typename T, ListHook T::*Hook> Rank IntrusiveList<T, Hook>::clear() { //摘除全部对象，O(n)复位各Hook
+   Rank oldSize = _size;
+   for ( ListHook* h = header.succ; h != &trailer; ) { ListHook* x = h; h = h->succ; x->pred = x->succ = NULL; }
+   header.succ = &trailer; trailer.pred = &header; _size = 0;
+   return oldSize;
+}
+
+template <typename T, ListHook T::*Hook>
+T* IntrusiveList<T, Hook>::find( T const& e ) const {
+   for ( ListHook* h = header.succ; h != &trailer; h = h->succ )
+      if ( e == *owner( h ) ) return owner( h );
+   return NULL;
+}
+
+template <typename T, ListHook T::*Hook> Rank IntrusiveList<T, Hook>::dedup() {
+   Rank oldSize = _size;
+   for ( ListHook* h = header.succ; h != &trailer; h = h->succ ) {
+      ListHook* q = h->succ;
+      while ( q != &trailer ) { //摘除h之后所有与h相等者
+         ListHook* x = q; q = q->succ;
+         if ( *owner( x ) == *owner( h ) ) remove( owner( x ) );
+      }
+   }
+   return oldSize - _size;
+}
+
+template <typename T, ListHook T::*Hook> Rank IntrusiveList<T, Hook>::uniquify() {
+   if ( _size < 2 ) return 0;
+   Rank oldSize = _size;
+   ListHook* p = header.succ; ListHook* q;
+   while ( &trailer != ( q = p->succ ) )
+      if ( *owner( p ) != *owner( q ) ) p = q;
+      else remove( owner( q ) );
+   return oldSize - _size;
+}
+
+template <typename T, ListHook T::*Hook> //归并两个以succ单链、NULL结尾的有序段（相等时a段在前）
+ListHook* IntrusiveList<T, Hook>::mergeRuns( ListHook* a, ListHook* b ) {
+   ListHook* h = NULL; ListHook** last = &h;
+   while ( a && b )
+      if ( *owner( b ) < *owner( a ) ) { *last = b; last = &b->succ; b = b->succ; }
+      else                             { *last = a; last = &a->succ; a = a->succ; }
+   *last = a ? a : b;
+   return h;
+}
+
+template <typename T, ListHook T::*Hook> void IntrusiveList<T, Hook>::sort() { //同List::mergeSort
+   if ( _size < 2 ) return;
+   ListHook* x = header.succ;
+   ListHook* bin[8 * sizeof( Rank )] = { NULL }; //bin[i]：长度为2^i的待归并有序段
+   for ( Rank k = 1; k < _size; k++ ) {
+      ListHook* run = x; x = x->succ; run->succ = NULL;
+      int i = 0;
+      for ( ; bin[i]; i++ ) { run = mergeRuns( bin[i], run ); bin[i] = NULL; }
+      bin[i] = run;
+   }
+   ListHook* b = x; b->succ = NULL;
+   int top = 8 * sizeof( Rank ) - 1; while ( !bin[top] ) top--;
+   for ( int i = 0; i < top; i++ )
+      if ( bin[i] ) b = mergeRuns( bin[i], b );
+   ListHook* a = bin[top]; ListHook* pre = &header; //末趟归并：边归并边补齐pred
+   while ( a && b )
+      if ( *owner( b ) < *owner( a ) ) { pre->succ = b; b->pred = pre; pre = b; b = b->succ; }
+      else                             { pre->succ = a; a->pred = pre; pre = a; a = a->succ; }
+   for ( a = a ? a : b; a; a = a->succ ) { pre->succ = a; a->pred = pre; pre = a; }
+   pre->succ = &trailer; trailer.pred = pre;
+}
+
+template <typename T, ListHook T::*Hook> void IntrusiveList<T, Hook>::traverse( void ( *visit )( T& ) )
+{  for ( ListHook* h = header.succ; h != &trailer; h = h->succ ) visit( *owner( h ) );  }
+
+template <typename T, ListHook T::*Hook> template <typename VST>
+void IntrusiveList<T, Hook>::traverse( VST& visit )
+{  for ( ListHook* h = header.succ; h != &trailer; h = h->succ ) visit( *owner( h ) );  }
+
+
+
+#endif  // INTRUSIVE_LIST_H
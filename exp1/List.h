@@ -2,6 +2,7 @@
 #define LIST_H
 #include <iostream>
 #include <cstdlib>
+#include <utility>
 using namespace std;
 
 template <typename T> struct ListNode;
@@ -13,12 +14,15 @@ private:
     ListNodePosi<T> head, tail; // 头、尾哨兵节点
     void init(); // 初始化
     void copyNodes(ListNodePosi<T> p, Rank n); // 复制节点
+    void transfer(ListNodePosi<T> p, ListNodePosi<T> first, ListNodePosi<T> last); // 将[first, last]整段摘下并接入p之前
+    static ListNodePosi<T> mergeRuns(ListNodePosi<T> a, ListNodePosi<T> b); // 归并两个以succ单链、NULL结尾的有序段
 public:
     // 构造函数
     List() { init(); } // 默认构造
     List(ListNodePosi<T> p, Rank n) { copyNodes(p, n); } // 区间构造
     List(List<T> const& L) { copyNodes(L.first(), L._size); } // 拷贝构造
     List(List<T> const& L, Rank r, Rank n); // 区间拷贝构造（声明）
+    List(List<T>&& L) { init(); splice(tail, L); } // 移动构造：接管L的全部节点，L变为空表
     
     // 析构函数
     ~List(); // 析构（声明）
@@ -41,6 +45,12 @@ public:
     // 删除操作
     T remove(ListNodePosi<T> p); // 删除节点
     Rank clear(); // 清空列表
+
+    // 节点迁移（仅重连指针，不分配、不复制data）
+    void splice(ListNodePosi<T> p, List<T>& L); // 将L全部节点移至p之前，O(1)
+    void splice(ListNodePosi<T> p, List<T>& L, ListNodePosi<T> first, Rank n); // 将L中自first起的n个节点移至p之前
+    List<T> splitAt(ListNodePosi<T> p); // 自p（含）起至末尾的节点拆出为新列表
+    void append(List<T>&& L) { splice(tail, L); } // 将L整体接至末尾，O(1)
     
     // 查找与去重
     ListNodePosi<T> find(T const& e, Rank n, ListNodePosi<T> p) const; // 无序查找
@@ -139,12 +149,6 @@ void List<T>::copyNodes( ListNodePosi<T> p, Rank n ) {
    while ( n-- ) { insertLast( p->data ); p = p->succ; }
 }
 
-template <typename T> //复制列表中自位置p起的n项（assert: p为合法位置，且至少有n-1个后继节点）
-List<T>::List( ListNodePosi<T> p, Rank n ) { copyNodes( p, n ); }
-
-template <typename T> //整体复制列表L
-List<T>::List( List<T> const& L ) { copyNodes( L.first(), L._size ); }
-
 template <typename T> //复制L中自第r项起的n项（assert: r+n <= L._size）
 List<T>::List( List<T> const& L, Rank r, Rank n ) {
    ListNodePosi<T> p = L.first();
@@ -159,6 +163,40 @@ template <typename T> T List<T>::remove( ListNodePosi<T> p ) { //删除合法节
    return e;
 }
 
+template <typename T> //列表内部方法：将[first, last]整段自原处摘下，接入p之前（assert: p不在该段内）
+void List<T>::transfer( ListNodePosi<T> p, ListNodePosi<T> first, ListNodePosi<T> last ) {
+   first->pred->succ = last->succ; last->succ->pred = first->pred;
+   first->pred = p->pred; last->succ = p;
+   p->pred->succ = first; p->pred = last;
+}
+
+template <typename T> //将列表L的全部节点移至p（可能是tail）之前，L变为空表
+void List<T>::splice( ListNodePosi<T> p, List<T>& L ) {
+   if ( ( this == &L ) || L.empty() ) return;
+   transfer( p, L.first(), L.last() );
+   _size += L._size; L._size = 0;
+}
+
+template <typename T> //将列表L中自first起的n个节点移至p之前（assert: first起至少有n个节点，且不含p）
+void List<T>::splice( ListNodePosi<T> p, List<T>& L, ListNodePosi<T> first, Rank n ) {
+   if ( n < 1 ) return;
+   ListNodePosi<T> last = first;
+   for ( Rank i = 1; i < n; i++ ) last = last->succ; //仅为定位段尾，无分配
+   transfer( p, first, last );
+   if ( this != &L ) { _size += n; L._size -= n; }
+}
+
+template <typename T> //将自p（含，可能是tail）起至末尾的节点拆出，作为新列表返回
+List<T> List<T>::splitAt( ListNodePosi<T> p ) {
+   List<T> L; Rank k = 0;
+   for ( ListNodePosi<T> x = p; x != tail; x = x->succ ) k++;
+   if ( 0 < k ) {
+      L.transfer( L.tail, p, last() );
+      L._size = k; _size -= k;
+   }
+   return L;
+}
+
 template <typename T> List<T>::~List() //列表析构器
 { clear();
   delete head;
@@ -249,18 +287,50 @@ ListNodePosi<T> List<T>::merge( ListNodePosi<T> p, Rank n,
    while ( ( 0 < m ) && ( q != p ) )
       if ( ( 0 < n ) && ( p->data <= q->data ) )
          { p = p->succ; n--; }
-      else
-         { insert( L.remove( ( q = q->succ )->pred ), p ); m--; }
+      else { //q起严格小于p的一段（p段已尽时则为剩余全部）整体迁至p之前
+         ListNodePosi<T> last = q; Rank k = 1;
+         while ( ( k < m ) && ( ( n < 1 ) || ( last->succ->data < p->data ) ) )
+            { last = last->succ; k++; }
+         ListNodePosi<T> next = last->succ;
+         transfer( p, q, last );
+         if ( this != &L ) { _size += k; L._size -= k; }
+         q = next; m -= k;
+      }
    return pp->succ;
 }
 
-template <typename T> //列表的归并排序算法：对起始于位置p的n个元素排序
+template <typename T> //归并两个以succ单链、NULL结尾的有序段（相等时a段在前，保证稳定）
+ListNodePosi<T> List<T>::mergeRuns( ListNodePosi<T> a, ListNodePosi<T> b ) {
+   ListNodePosi<T> h = NULL; ListNodePosi<T>* last = &h;
+   while ( a && b )
+      if ( b->data < a->data ) { *last = b; last = &b->succ; b = b->succ; }
+      else                     { *last = a; last = &a->succ; a = a->succ; }
+   *last = a ? a : b;
+   return h;
+}
+
+template <typename T> //列表的归并排序算法（自底向上、非递归）：对起始于位置p的n个元素排序
 void List<T>::mergeSort( ListNodePosi<T>& p, Rank n ) {
    if ( n < 2 ) return;
-   Rank m = n >> 1;
-   ListNodePosi<T> q = p; for ( Rank i = 0; i < m; i++ ) q = q->succ;
-   mergeSort( p, m ); mergeSort( q, n - m );
-   p = merge( p, m, *this, q, n - m );
+   ListNodePosi<T> h = p->pred, x = p;
+   ListNodePosi<T> bin[8 * sizeof( Rank )] = { NULL }; //bin[i]：长度为2^i的待归并有序段（二进制计数器）
+   for ( Rank k = 1; k < n; k++ ) { //前n-1个节点逐个摘下，作为长度为1的段逐级进位归并
+      ListNodePosi<T> run = x; x = x->succ; run->succ = NULL;
+      int i = 0;
+      for ( ; bin[i]; i++ ) { run = mergeRuns( bin[i], run ); bin[i] = NULL; }
+      bin[i] = run;
+   }
+   ListNodePosi<T> b = x; x = x->succ; b->succ = NULL; //末个节点单独成段；此后x为区间之后的节点
+   int top = 8 * sizeof( Rank ) - 1; while ( !bin[top] ) top--;
+   for ( int i = 0; i < top; i++ ) //由低到高收拢除最高段外的各段（高位段更早，须在前）
+      if ( bin[i] ) b = mergeRuns( bin[i], b );
+   ListNodePosi<T> a = bin[top], pre = h; //末趟归并：边归并边补齐pred，并接回原区间两端
+   while ( a && b )
+      if ( b->data < a->data ) { pre->succ = b; b->pred = pre; pre = b; b = b->succ; }
+      else                     { pre->succ = a; a->pred = pre; pre = a; a = a->succ; }
+   for ( a = a ? a : b; a; a = a->succ ) { pre->succ = a; a->pred = pre; pre = a; }
+   pre->succ = x; x->pred = pre;
+   p = h->succ;
 }
 
 
@@ -0,0 +1,185 @@
+#ifndef MPMC_QUEUE_H
+#define MPMC_QUEUE_H
+#include <iostream>
+#include <cstdlib>
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <thread>
+using namespace std;
+
+#ifndef CACHE_LINE_SIZE
+#define CACHE_LINE_SIZE 64 // 缓存行大小
+#endif
+
+// 多生产者/多消费者有界队列（Vyukov算法）：
+// 每个槽位带序号seq，生产者/消费者各以一次CAS抢占入队/出队位置，随后仅操作自己的槽位
+// 对位置pos的槽位：seq == pos 表示空闲可写，seq == pos + 1 表示已写入可读，读后置为 pos + 容量
+// try系列不阻塞；阻塞系列先自旋若干次，仍不成功再在条件变量上休眠（可设超时）
+template <typename T> class MpmcQueue {
+private:
+    struct Cell {
+        atomic<size_t> seq; // 槽位序号
+        T data;
+    };
+
+    static const int SPIN_LIMIT = 64; // 阻塞操作休眠前的自旋次数
+
+    Cell* _cells;     // 环形槽位数组（构造后只读）
+    size_t _mask;     // 容量 - 1
+
+    alignas(CACHE_LINE_SIZE) atomic<size_t> _enqueuePos; // 下一个入队位置
+    alignas(CACHE_LINE_SIZE) atomic<size_t> _dequeuePos; // 下一个出队位置
+
+    alignas(CACHE_LINE_SIZE) mutex _lock;       // 仅供休眠/唤醒使用
+    condition_variable _notEmpty, _notFull;
+    atomic<int> _emptyWaiters, _fullWaiters;    // 正在休眠（或即将休眠）的消费者/生产者数
+
+    // 若有线程在cv上休眠则唤醒之；与休眠方的“先登记、再重试”配合，避免丢失唤醒
+    void wake(atomic<int>& waiters, condition_variable& cv) {
+        atomic_thread_fence(memory_order_seq_cst);
+        if (waiters.load(memory_order_relaxed) > 0) {
+            lock_guard<mutex> g(_lock);
+            cv.notify_all();
+        }
+    }
+
+    // 阻塞执行tryOp：先自旋，再登记为等待者并在cv上休眠，直至成功或到达deadline
+    template <typename Op>
+    bool block(Op tryOp, atomic<int>& waiters, condition_variable& cv,
+               chrono::steady_clock::time_point const* deadline) {
+        for (int i = 0; i < SPIN_LIMIT; i++) {
+            if (tryOp()) return true;
+            if (i >= SPIN_LIMIT / 2) this_thread::yield();
+        }
+        unique_lock<mutex> lk(_lock);
+        waiters.fetch_add(1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst); // 与wake中的栅栏配对：要么对方看到登记，要么此后重试看到对方的操作
+        bool ok;
+        while (!(ok = tryOp())) {
+            if (!deadline) cv.wait(lk);
+            else if (cv.wait_until(lk, *deadline) == cv_status::timeout) {
+                ok = tryOp();
+                break;
+            }
+        }
+        waiters.fetch_sub(1, memory_order_relaxed);
+        return ok;
+    }
+
+    // 无唤醒的入队/出队尝试（Vyukov算法本体）
+    bool tryPush(T const& e) {
+        size_t pos = _enqueuePos.load(memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            intptr_t dif = (intptr_t)cell->seq.load(memory_order_acquire) - (intptr_t)pos;
+            if (dif == 0) {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) break;
+            } else if (dif < 0) {
+                return false; // 队满
+            } else {
+                pos = _enqueuePos.load(memory_order_relaxed);
+            }
+        }
+        cell->data = e;
+        cell->seq.store(pos + 1, memory_order_release);
+        return true;
+    }
+
+    bool tryPop(T& e) {
+        size_t pos = _dequeuePos.load(memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            intptr_t dif = (intptr_t)cell->seq.load(memory_order_acquire) - (intptr_t)(pos + 1);
+            if (dif == 0) {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) break;
+            } else if (dif < 0) {
+                return false; // 队空
+            } else {
+                pos = _dequeuePos.load(memory_order_relaxed);
+            }
+        }
+        e = cell->data;
+        cell->seq.store(pos + _mask + 1, memory_order_release);
+        return true;
+    }
+
+    MpmcQueue(MpmcQueue<T> const&);            // 禁止复制
+    MpmcQueue<T>& operator=(MpmcQueue<T> const&);
+
+public:
+    // 构造函数：容量取不小于c的2的幂
+    explicit MpmcQueue(int c = 1024)
+        : _enqueuePos(0), _dequeuePos(0), _emptyWaiters(0), _fullWaiters(0) {
+        size_t capacity = 2;
+        while (capacity < (size_t)c) capacity <<= 1;
+        _cells = new Cell[capacity];
+        for (size_t i = 0; i < capacity; i++) _cells[i].seq.store(i, memory_order_relaxed);
+        _mask = capacity - 1;
+    }
+
+    // 析构函数（须确保已无其他线程访问）
+    ~MpmcQueue() { delete[] _cells; }
+
+    int capacity() const { return (int)(_mask + 1); }
+    // 规模（并发时仅为近似值）
+    int size() const {
+        size_t tail = _enqueuePos.load(memory_order_relaxed);
+        size_t head = _dequeuePos.load(memory_order_relaxed);
+        return tail > head ? (int)(tail - head) : 0;
+    }
+    bool empty() const { return size() == 0; }
+
+    // 非阻塞入队：队满则返回false
+    bool tryEnqueue(T const& e) {
+        if (!tryPush(e)) return false;
+        wake(_emptyWaiters, _notEmpty);
+        return true;
+    }
+
+    // 非阻塞出队：队空则返回false
+    bool tryDequeue(T& e) {
+        if (!tryPop(e)) return false;
+        wake(_fullWaiters, _notFull);
+        return true;
+    }
+
+    // 阻塞入队：队满则等待
+    void enqueue(T const& e) {
+        block([&] { return tryPush(e); }, _fullWaiters, _notFull, nullptr);
+        wake(_emptyWaiters, _notEmpty);
+    }
+
+    // 阻塞出队：队空则等待
+    T dequeue() {
+        T e;
+        block([&] { return tryPop(e); }, _emptyWaiters, _notEmpty, nullptr);
+        wake(_fullWaiters, _notFull);
+        return e;
+    }
+
+    // 限时入队：至多等待timeoutMs毫秒，超时返回false
+    bool enqueue(T const& e, long timeoutMs) {
+        chrono::steady_clock::time_point deadline = chrono::steady_clock::now() + chrono::milliseconds(timeoutMs);
+        if (!block([&] { return tryPush(e); }, _fullWaiters, _notFull, &deadline)) return false;
+        wake(_emptyWaiters, _notEmpty);
+        return true;
+    }
+
+    // 限时出队：至多等待timeoutMs毫秒，超时返回false
+    bool dequeue(T& e, long timeoutMs) {
+        chrono::steady_clock::time_point deadline = chrono::steady_clock::now() + chrono::milliseconds(timeoutMs);
+        if (!block([&] { return tryPop(e); }, _emptyWaiters, _notEmpty, &deadline)) return false;
+        wake(_fullWaiters, _notFull);
+        return true;
+    }
+};
+
+
+
+#endif  // MPMC_QUEUE_H
@@ -0,0 +1,233 @@
+#ifndef POOLED_TREE_H
+#define POOLED_TREE_H
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+#include "Stack.h"
+#include "Queue.h"
+using namespace std;
+
+typedef unsigned int NodeIdx; // 节点在池中的下标
+#define NIL_NODE ((NodeIdx)-1) // 空节点
+
+// 池式二叉树：接口同Tree，但全部节点连续存放于一个数组（节点池）中，以32位下标代替指针互相引用
+// 树不支持删除单个节点，故节点池只增不减：插入即追加到池尾，clear为O(1)
+// 下标与池的地址无关，故整树复制只需整块复制节点池（平凡可复制类型为一次memcpy），无需修正任何链接
+// 节点按插入顺序排列；调用relayout()可按层序重排，此后层序遍历即为顺序扫描，其余遍历也大多顺序访存
+template <typename T> class PooledTree {
+private:
+    struct Node {
+        T data;
+        NodeIdx parent, left, right; // 三个链接共12字节，Tree::Node的三个指针则为24字节
+    };
+
+    Node* _pool;     // 节点池
+    int _size;       // 规模（即池中已用节点数）
+    int _capacity;   // 池容量
+    NodeIdx root;    // 根（非空时恒为0）
+    bool _levelOrdered; // 池是否恰为层序排列
+
+    static void copyNodes(Node* dst, Node const* src, int n) {
+        if (n < 1) return;
+        if (is_trivially_copyable<T>::value) memcpy((void*)dst, (void const*)src, n * sizeof(Node));
+        else for (int i = 0; i < n; i++) dst[i] = src[i];
+    }
+
+    void reserve(int c) {
+        if (c <= _capacity) return;
+        Node* oldPool = _pool;
+        _pool = new Node[_capacity = c];
+        copyNodes(_pool, oldPool, _size);
+        delete[] oldPool;
+    }
+
+    NodeIdx newNode(T const& e, NodeIdx parent) {
+        if (_size == _capacity) reserve(_capacity < 8 ? 8 : _capacity << 1);
+        Node& x = _pool[_size];
+        x.data = e;
+        x.parent = parent;
+        x.left = x.right = NIL_NODE;
+        return (NodeIdx)_size++;
+    }
+
+public:
+    // 构造函数
+    PooledTree() : _pool(nullptr), _size(0), _capacity(0), root(NIL_NODE), _levelOrdered(true) {}
+    PooledTree(T const& rootData) : _pool(nullptr), _size(0), _capacity(0), root(NIL_NODE), _levelOrdered(true) {
+        root = newNode(rootData, NIL_NODE);
+    }
+
+    // 拷贝构造函数：整块复制节点池
+    PooledTree(PooledTree<T> const& tree) : _pool(nullptr), _size(0), _capacity(0), root(NIL_NODE), _levelOrdered(true) {
+        *this = tree;
+    }
+
+    // 析构函数
+    ~PooledTree() { delete[] _pool; }
+
+    // 赋值运算符
+    PooledTree<T>& operator=(PooledTree<T> const& tree) {
+        if (this != &tree) {
+            clear();
+            reserve(tree._size);
+            copyNodes(_pool, tree._pool, tree._size);
+            _size = tree._size;
+            root = tree.root;
+            _levelOrdered = tree._levelOrdered;
+        }
+        return *this;
+    }
+
+    // 基本操作
+    int size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    // 获取根节点数据
+    T& rootData() const {
+        if (empty()) {
+            cerr << "树为空，无法访问根节点！" << endl;
+            exit(EXIT_FAILURE);
+        }
+        return _pool[root].data;
+    }
+
+    // 插入左孩子
+    NodeIdx insertLeft(NodeIdx parent, T const& e) {
+        if (parent == NIL_NODE || _pool[parent].left != NIL_NODE) {
+            cerr << "插入左孩子失败！" << endl;
+            return NIL_NODE;
+        }
+        NodeIdx x = newNode(e, parent); // 先分配：扩容可能使_pool失效
+        _pool[parent].left = x;
+        _levelOrdered = false;
+        return x;
+    }
+
+    // 插入右孩子
+    NodeIdx insertRight(NodeIdx parent, T const& e) {
+        if (parent == NIL_NODE || _pool[parent].right != NIL_NODE) {
+            cerr << "插入右孩子失败！" << endl;
+            return NIL_NODE;
+        }
+        NodeIdx x = newNode(e, parent);
+        _pool[parent].right = x;
+        _levelOrdered = false;
+        return x;
+    }
+
+    // 清空树：O(1)，保留节点池容量
+    void clear() {
+        _size = 0;
+        root = NIL_NODE;
+        _levelOrdered = true;
+    }
+
+    // 按层序重排节点池（一次遍历+一次整体搬移），使后续遍历大多顺序访存
+    void relayout() {
+        if (_levelOrdered) return;
+        Node* pool = new Node[_capacity];
+        NodeIdx* newIdx = new NodeIdx[_size];   // 旧下标 -> 新下标
+        int n = 0;
+        pool[n] = _pool[root];
+        newIdx[root] = n++;
+        for (int i = 0; i < n; i++) { // pool[0..n)即层序队列
+            NodeIdx l = pool[i].left, r = pool[i].right;
+            if (l != NIL_NODE) { pool[n] = _pool[l]; newIdx[l] = n++; }
+            if (r != NIL_NODE) { pool[n] = _pool[r]; newIdx[r] = n++; }
+        }
+        for (int i = 0; i < n; i++) { // 修正链接
+            Node& x = pool[i];
+            if (x.parent != NIL_NODE) x.parent = newIdx[x.parent];
+            if (x.left != NIL_NODE) x.left = newIdx[x.left];
+            if (x.right != NIL_NODE) x.right = newIdx[x.right];
+        }
+        delete[] newIdx;
+        delete[] _pool;
+        _pool = pool;
+        root = 0;
+        _levelOrdered = true;
+    }
+
+    // 节点访问（下标在relayout后失效）
+    NodeIdx getRoot() const { return root; }
+    NodeIdx getLeft(NodeIdx x) const { return _pool[x].left; }
+    NodeIdx getRight(NodeIdx x) const { return _pool[x].right; }
+    NodeIdx getParent(NodeIdx x) const { return _pool[x].parent; }
+    T& getData(NodeIdx x) const { return _pool[x].data; }
+
+    // 先序遍历
+    void preOrder(void (*visit)(T&)) const {
+        if (empty()) return;
+        Stack<NodeIdx> stack;
+        stack.push(root);
+        while (!stack.empty()) {
+            Node& x = _pool[stack.pop()];
+            visit(x.data);
+            if (x.right != NIL_NODE) stack.push(x.right);
+            if (x.left != NIL_NODE) stack.push(x.left);
+        }
+    }
+
+    // 中序遍历
+    void inOrder(void (*visit)(T&)) const {
+        Stack<NodeIdx> stack;
+        NodeIdx curr = root;
+        while (!stack.empty() || curr != NIL_NODE) {
+            while (curr != NIL_NODE) {
+                stack.push(curr);
+                curr = _pool[curr].left;
+            }
+            curr = stack.pop();
+            visit(_pool[curr].data);
+            curr = _pool[curr].right;
+        }
+    }
+
+    // 后序遍历
+    void postOrder(void (*visit)(T&)) const {
+        Stack<NodeIdx> stack;
+        NodeIdx curr = root, last = NIL_NODE;
+        while (!stack.empty() || curr != NIL_NODE) {
+            while (curr != NIL_NODE) {
+                stack.push(curr);
+                curr = _pool[curr].left;
+            }
+            NodeIdx top = stack.peek();
+            if (_pool[top].right != NIL_NODE && _pool[top].right != last) {
+                curr = _pool[top].right;
+            } else {
+                stack.pop();
+                visit(_pool[top].data);
+                last = top;
+            }
+        }
+    }
+
+    // 层序遍历：池已按层序排列时即为顺序扫描，否则借助队列
+    void levelOrder(void (*visit)(T&)) const {
+        if (_levelOrdered) {
+            for (int i = 0; i < _size; i++) visit(_pool[i].data);
+            return;
+        }
+        Queue<NodeIdx> queue;
+        queue.enqueue(root);
+        while (!queue.empty()) {
+            Node& x = _pool[queue.dequeue()];
+            visit(x.data);
+            if (x.left != NIL_NODE) queue.enqueue(x.left);
+            if (x.right != NIL_NODE) queue.enqueue(x.right);
+        }
+    }
+
+    // 打印树（层序遍历）
+    void print() const {
+        cout << "层序遍历: ";
+        levelOrder([](T& e) { cout << e << " "; });
+        cout << endl;
+    }
+};
+
+
+
+#endif  // POOLED_TREE_H
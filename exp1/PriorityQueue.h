@@ -0,0 +1,327 @@
+#ifndef PRIORITY_QUEUE_H
+#define PRIORITY_QUEUE_H
+#include <iostream>
+#include <cstdlib>
+#include <functional>
+#include <cstring>
+#include <type_traits>
+#include <new>
+#include <utility>
+#include "Vector.h"
+using namespace std;
+
+// 优先级队列：以数组存放的完全D叉堆（D=2即二叉堆；D=4时树更矮、下滤时比较更集中于同一缓存行）
+// 按Compare约定，堆顶为“最大”者：默认less<T>得大顶堆，greater<T>得小顶堆（如Dijkstra）
+// 下标i的孩子为D*i+1..D*i+D，父亲为(i-1)/D
+// 堆数组为未初始化的原始内存（同Stack）：元素插入时才构造、删除或清空时即析构，故T无需可默认构造
+template <typename T, int D = 2, typename Compare = less<T> > class PriorityQueue {
+private:
+    T* _elem;       // 堆数组（仅[0, _size)中的元素已构造）
+    int _size;      // 规模
+    int _capacity;  // 容量
+    Compare _cmp;
+
+    // 上滤：将i处元素向上移至合适位置（逐层下移父亲，最后一次性落位）
+    void percolateUp(int i) {
+        T e = std::move(_elem[i]);
+        while (0 < i) {
+            int p = (i - 1) / D;
+            if (!_cmp(_elem[p], e)) break;
+            _elem[i] = std::move(_elem[p]);
+            i = p;
+        }
+        _elem[i] = std::move(e);
+    }
+
+    // 下滤：将i处元素向下移至合适位置
+    void percolateDown(int i) {
+        T e = std::move(_elem[i]);
+        for (;;) {
+            int c = D * i + 1;
+            if (c >= _size) break;
+            int last = (c + D < _size) ? c + D : _size;
+            int best = c;
+            for (int j = c + 1; j < last; j++)
+                if (_cmp(_elem[best], _elem[j])) best = j;
+            if (!_cmp(e, _elem[best])) break;
+            _elem[i] = std::move(_elem[best]);
+            i = best;
+        }
+        _elem[i] = std::move(e);
+    }
+
+    // 复制自src起的n个元素至_elem[0, n)（须已为空且容量足够）
+    void copyFrom(T const* src, int n) {
+        if (is_trivially_copyable<T>::value) {
+            if (n) memcpy((void*)_elem, (void const*)src, n * sizeof(T));
+        } else {
+            for (int i = 0; i < n; i++) new (_elem + i) T(src[i]);
+        }
+        _size = n;
+    }
+
+public:
+    // 构造函数
+    PriorityQueue() : _elem(nullptr), _size(0), _capacity(0) {}
+    PriorityQueue(Vector<T> const& V) : _elem(nullptr), _size(0), _capacity(0) { heapify(V); }
+
+    // 析构函数
+    ~PriorityQueue() {
+        clear();
+        ::operator delete(_elem);
+    }
+
+    // 拷贝构造函数
+    PriorityQueue(PriorityQueue const& pq) : _elem(nullptr), _size(0), _capacity(0) { *this = pq; }
+
+    // 赋值运算符
+    PriorityQueue& operator=(PriorityQueue const& pq) {
+        if (this != &pq) {
+            clear();
+            reserve(pq._size);
+            copyFrom(pq._elem, pq._size);
+        }
+        return *this;
+    }
+
+    int size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    // 清空：析构全部元素，保留已分配的容量
+    void clear() {
+        if (!is_trivially_destructible<T>::value)
+            for (int i = 0; i < _size; i++) _elem[i].~T();
+        _size = 0;
+    }
+
+    // 预留容量
+    void reserve(int c) {
+        if (c <= _capacity) return;
+        T* oldElem = _elem;
+        _elem = static_cast<T*>(::operator new(c * sizeof(T)));
+        _capacity = c;
+        if (is_trivially_copyable<T>::value) {
+            if (_size) memcpy((void*)_elem, (void const*)oldElem, _size * sizeof(T));
+        } else {
+            for (int i = 0; i < _size; i++) { // 逐个移入新数据区，并析构旧元素
+                new (_elem + i) T(std::move(oldElem[i]));
+                oldElem[i].~T();
+            }
+        }
+        ::operator delete(oldElem);
+    }
+
+    // 批量建堆（Floyd算法）：以V的全部元素替换当前内容，O(n)
+    void heapify(Vector<T> const& V) {
+        clear();
+        reserve(V.size());
+        for (int i = 0; i < V.size(); i++) new (_elem + i) T(V[i]);
+        _size = V.size();
+        if (_size < 2) return; // 否则(_size - 2) / D在D >= 3时向零取整为0，空堆将访问_elem[0]
+        for (int i = (_size - 2) / D; 0 <= i; i--) percolateDown(i);
+    }
+
+    // 插入（满则容量加倍）
+    void push(T const& e) {
+        if (_size == _capacity) { // e可能引用堆中元素（如push(top())），须在扩容（旧数组释放）前复制
+            T x(e);
+            reserve(_capacity < 8 ? 8 : _capacity << 1);
+            new (_elem + _size) T(std::move(x));
+        } else {
+            new (_elem + _size) T(e);
+        }
+        percolateUp(_size++);
+    }
+
+    // 取堆顶
+    T& top() const {
+        if (empty()) {
+            cerr << "优先级队列为空，无法执行top操作！" << endl;
+            exit(EXIT_FAILURE);
+        }
+        return _elem[0];
+    }
+
+    // 删除并返回堆顶
+    T pop() {
+        if (empty()) {
+            cerr << "优先级队列为空，无法执行pop操作！" << endl;
+            exit(EXIT_FAILURE);
+        }
+        T e = std::move(_elem[0]);
+        if (--_size) {
+            _elem[0] = std::move(_elem[_size]);
+            _elem[_size].~T();
+            percolateDown(0);
+        } else {
+            _elem[0].~T();
+        }
+        return e;
+    }
+};
+
+// 索引优先级队列：push返回句柄，可按句柄修改优先级（decreaseKey）或删除（erase）
+// 堆中存放句柄，另以_pos记录各句柄在堆中的下标；句柄在元素删除后回收复用
+// _key为未初始化的原始内存：仅有效句柄的元素已构造
+template <typename T, int D = 2, typename Compare = less<T> > class IndexedPriorityQueue {
+private:
+    T* _key;        // _key[h]：句柄h的元素
+    int* _pos;      // _pos[h]：句柄h在堆中的下标（-1表示空闲句柄）
+    int* _heap;     // 堆数组，存放句柄
+    int _size;      // 规模
+    int _capacity;  // 句柄容量
+    int _free;      // 空闲句柄链表头（-1表示无空闲句柄）
+    int* _freeNext; // 空闲句柄链表的后继
+    Compare _cmp;
+
+    bool before(int a, int b) const { return _cmp(_key[_heap[b]], _key[_heap[a]]); } // 堆中a处应在b处之上
+
+    void place(int i, int h) { _heap[i] = h; _pos[h] = i; }
+
+    void percolateUp(int i) {
+        int h = _heap[i];
+        while (0 < i) {
+            int p = (i - 1) / D;
+            if (!_cmp(_key[_heap[p]], _key[h])) break;
+            place(i, _heap[p]);
+            i = p;
+        }
+        place(i, h);
+    }
+
+    void percolateDown(int i) {
+        int h = _heap[i];
+        for (;;) {
+            int c = D * i + 1;
+            if (c >= _size) break;
+            int last = (c + D < _size) ? c + D : _size;
+            int best = c;
+            for (int j = c + 1; j < last; j++)
+                if (before(j, best)) best = j;
+            if (!_cmp(_key[h], _key[_heap[best]])) break;
+            place(i, _heap[best]);
+            i = best;
+        }
+        place(i, h);
+    }
+
+    void expand() {
+        if (_free != -1) return;
+        int c = _capacity < 8 ? 8 : _capacity << 1;
+        T* key = static_cast<T*>(::operator new(c * sizeof(T)));
+        int* pos = new int[c];
+        int* heap = new int[c];
+        int* freeNext = new int[c];
+        for (int i = 0; i < _capacity; i++) { // 无空闲句柄，故全部句柄有效
+            new (key + i) T(std::move(_key[i]));
+            _key[i].~T();
+            pos[i] = _pos[i]; heap[i] = _heap[i]; freeNext[i] = _freeNext[i];
+        }
+        for (int h = c - 1; h >= _capacity; h--) { pos[h] = -1; freeNext[h] = _free; _free = h; }
+        ::operator delete(_key);
+        delete[] _pos; delete[] _heap; delete[] _freeNext;
+        _key = key; _pos = pos; _heap = heap; _freeNext = freeNext;
+        _capacity = c;
+    }
+
+    void check(int h, char const* op) const {
+        if (!contains(h)) {
+            cerr << "句柄无效，无法执行" << op << "操作！" << endl;
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    IndexedPriorityQueue(IndexedPriorityQueue const&);            // 禁止复制
+    IndexedPriorityQueue& operator=(IndexedPriorityQueue const&);
+
+public:
+    // 构造函数
+    IndexedPriorityQueue()
+        : _key(nullptr), _pos(nullptr), _heap(nullptr), _size(0), _capacity(0), _free(-1), _freeNext(nullptr) {}
+
+    // 析构函数
+    ~IndexedPriorityQueue() {
+        for (int i = 0; i < _size; i++) _key[_heap[i]].~T();
+        ::operator delete(_key);
+        delete[] _pos; delete[] _heap; delete[] _freeNext;
+    }
+
+    int size() const { return _size; }
+    bool empty() const { return _size == 0; }
+    bool contains(int h) const { return 0 <= h && h < _capacity && _pos[h] != -1; }
+    T const& key(int h) const { check(h, "key"); return _key[h]; }
+
+    // 插入，返回句柄
+    int push(T const& e) {
+        int h;
+        if (_free == -1) { // e可能引用已有元素，须在扩容（旧数组释放）前复制
+            T x(e);
+            expand();
+            h = _free;
+            new (_key + h) T(std::move(x));
+        } else {
+            h = _free;
+            new (_key + h) T(e);
+        }
+        _free = _freeNext[h];
+        place(_size, h);
+        percolateUp(_size++);
+        return h;
+    }
+
+    // 取堆顶元素及其句柄
+    T const& top() const {
+        if (empty()) {
+            cerr << "优先级队列为空，无法执行top操作！" << endl;
+            exit(EXIT_FAILURE);
+        }
+        return _key[_heap[0]];
+    }
+    int topHandle() const { return empty() ? -1 : _heap[0]; }
+
+    // 删除句柄h对应的元素并返回之，句柄随即失效
+    T erase(int h) {
+        check(h, "erase");
+        int i = _pos[h];
+        T e = std::move(_key[h]);
+        _key[h].~T();
+        place(i, _heap[--_size]);
+        _pos[h] = -1;
+        _freeNext[h] = _free;
+        _free = h;
+        if (i < _size) { // 原末元素填入i处，按需上滤或下滤
+            int m = _heap[i];
+            percolateUp(i);
+            percolateDown(_pos[m]);
+        }
+        return e;
+    }
+
+    // 删除并返回堆顶
+    T pop() {
+        if (empty()) {
+            cerr << "优先级队列为空，无法执行pop操作！" << endl;
+            exit(EXIT_FAILURE);
+        }
+        return erase(_heap[0]);
+    }
+
+    // 提升h的优先级：e须不劣于原元素（小顶堆中即键值减小），仅需上滤
+    void decreaseKey(int h, T const& e) {
+        check(h, "decreaseKey");
+        _key[h] = e;
+        percolateUp(_pos[h]);
+    }
+
+    // 任意修改h的元素，按需上滤或下滤
+    void changeKey(int h, T const& e) {
+        check(h, "changeKey");
+        _key[h] = e;
+        percolateUp(_pos[h]);
+        percolateDown(_pos[h]);
+    }
+};
+
+
+
+#endif  // PRIORITY_QUEUE_H
@@ -2,52 +2,91 @@
 #define QUEUE_H
 #include <iostream>
 #include <cstdlib>
+#include <cstring>
+#include <type_traits>
+#include <new>
+#include <utility>
 using namespace std;
 
+// 循环队列：元素存放于容量为2的幂的环形数组中，以掩码代替取模定位
+// 数据区为未初始化的原始内存：元素入队时才构造、出队或清空时即析构，故T无需可默认构造
 template <typename T> class Queue {
 private:
-    // 嵌套节点结构
-    struct Node {
-        T data;      
-        Node* next;  
-        // 节点构造函数
-        Node(T const& e, Node* n = nullptr) : data(e), next(n) {}
-    };
-
-    Node* frontNode;  
-    Node* rearNode;   
-    int _size;       
+    T* _elem;       // 环形数据区（仅队列中的元素已构造）
+    int _head;      // 队首所在下标
+    int _size;      // 规模
+    int _capacity;  // 容量（0或2的幂）
+
+    int slot(int i) const { return (_head + i) & (_capacity - 1); } // 第i个元素（自队首起）的下标
+
+    // 将自src起的n个元素复制到dst：construct为true时dst为原始内存（就地构造），否则为已有对象（赋值）
+    static void copyElems(T* dst, T const* src, int n, bool construct) {
+        if (n < 1) return;
+        if (is_trivially_copyable<T>::value) memcpy((void*)dst, (void const*)src, n * sizeof(T));
+        else if (construct) for (int i = 0; i < n; i++) new (dst + i) T(src[i]);
+        else for (int i = 0; i < n; i++) dst[i] = src[i];
+    }
+
+    // 将队列中自第i个元素起的n个元素依次复制到dst（至多分两段）
+    void copyOut(T* dst, int i, int n, bool construct) const {
+        int s = slot(i);
+        int k = (n < _capacity - s) ? n : _capacity - s; // 第一段：至数组末尾
+        copyElems(dst, _elem + s, k, construct);
+        copyElems(dst + k, _elem, n - k, construct);     // 第二段：回绕至数组开头
+    }
+
+    // 析构自第i个元素起的n个元素
+    void destroy(int i, int n) {
+        if (is_trivially_destructible<T>::value) return;
+        for (int k = 0; k < n; k++) _elem[slot(i + k)].~T();
+    }
+
+    // 扩容：确保至少可容纳_size + n个元素，容量取不小于此的2的幂，元素重排为自下标0起连续
+    // 并在原有元素之后构造A[0..n)——先于旧数据区释放，故A可指向本队列中的元素
+    void expand(int c, T const* A = nullptr, int n = 0) {
+        if (c <= _capacity) return;
+        int newCapacity = 8;
+        while (newCapacity < c) newCapacity <<= 1;
+        T* newElem = static_cast<T*>(::operator new(newCapacity * sizeof(T)));
+        copyElems(newElem + _size, A, n, true);
+        if (is_trivially_copyable<T>::value) {
+            if (_size) copyOut(newElem, 0, _size, true);
+        } else {
+            for (int i = 0; i < _size; i++) { // 逐个移入新数据区，并析构旧元素
+                new (newElem + i) T(std::move(_elem[slot(i)]));
+                _elem[slot(i)].~T();
+            }
+        }
+        ::operator delete(_elem);
+        _elem = newElem;
+        _capacity = newCapacity;
+        _head = 0;
+    }
 
 public:
     // 构造函数
-    Queue() : frontNode(nullptr), rearNode(nullptr), _size(0) {}
+    Queue() : _elem(nullptr), _head(0), _size(0), _capacity(0) {}
 
     // 析构函数
     ~Queue() {
         clear();
+        ::operator delete(_elem);
     }
 
     // 拷贝构造函数
-    Queue(Queue<T> const& q) {
-        frontNode = nullptr;
-        rearNode = nullptr;
-        _size = 0;
-        Node* p = q.frontNode;
-        while (p) {
-            enqueue(p->data);
-            p = p->next;
-        }
+    Queue(Queue<T> const& q) : _elem(nullptr), _head(0), _size(0), _capacity(0) {
+        expand(q._size);
+        if (q._size) q.copyOut(_elem, 0, q._size, true);
+        _size = q._size;
     }
 
     // 赋值运算符
     Queue<T>& operator=(Queue<T> const& q) {
         if (this != &q) {
-            clear();  
-            Node* p = q.frontNode;
-            while (p) {
-                enqueue(p->data);
-                p = p->next;
-            }
+            clear();
+            expand(q._size);
+            if (q._size) q.copyOut(_elem, 0, q._size, true);
+            _size = q._size;
         }
         return *this;
     }
@@ -55,18 +94,28 @@ public:
     // 基本操作
     int size() const { return _size; }        
     bool empty() const { return _size == 0; } 
+    int capacity() const { return _capacity; }
+    void reserve(int c) { expand(c); } // 预留容量
 
-    // 入队：在队尾插入元素
+    // 入队：在队尾插入元素（e可引用本队列中的元素）
     void enqueue(T const& e) {
-        Node* newNode = new Node(e);
-        if (empty()) {
-            frontNode = newNode;  
-            rearNode = newNode;
+        if (_size == _capacity) expand(_size + 1, &e, 1);
+        else new (_elem + slot(_size)) T(e);
+        _size++;
+    }
+
+    // 批量入队：A[0..n)依次入队
+    void enqueue(T const* A, int n) {
+        if (n < 1) return;
+        if (_size + n > _capacity) {
+            expand(_size + n, A, n);
         } else {
-            rearNode->next = newNode; 
-            rearNode = newNode;
+            int s = slot(_size);
+            int k = (n < _capacity - s) ? n : _capacity - s;
+            copyElems(_elem + s, A, k, true);
+            copyElems(_elem, A + k, n - k, true);
         }
-        _size++;
+        _size += n;
     }
 
     // 出队：删除并返回队首元素
@@ -75,25 +124,31 @@ public:
             cerr << "队列为空，无法执行dequeue操作！" << endl;
             exit(EXIT_FAILURE);
         }
-        Node* oldFront = frontNode;
-        T e = oldFront->data;
-        frontNode = frontNode->next; 
-        delete oldFront;
+        T e = std::move(_elem[_head]);
+        destroy(0, 1);
+        _head = slot(1);
         _size--;
-        // 若队列变空，队尾指针也置空
-        if (empty()) {
-            rearNode = nullptr;
-        }
         return e;
     }
 
+    // 批量出队：至多n个元素依次存入A，返回实际出队个数
+    int dequeue(T* A, int n) {
+        if (n > _size) n = _size;
+        if (n < 1) return 0;
+        copyOut(A, 0, n, false);
+        destroy(0, n);
+        _head = slot(n);
+        _size -= n;
+        return n;
+    }
+
     // 查看队首元素（不删除）
     T& front() const {
         if (empty()) {
             cerr << "队列为空，无法执行front操作！" << endl;
             exit(EXIT_FAILURE);
         }
-        return frontNode->data;
+        return _elem[_head];
     }
 
     // 查看队尾元素（不删除）
@@ -102,22 +157,23 @@ public:
             cerr << "队列为空，无法执行back操作！" << endl;
             exit(EXIT_FAILURE);
         }
-        return rearNode->data;
+        return _elem[slot(_size - 1)];
     }
 
-    // 清空队列
+    // 查看自队首起第i个元素（不删除，0 <= i < size()）
+    T& operator[](int i) const { return _elem[slot(i)]; }
+
+    // 清空队列：析构全部元素，保留已分配的容量
     void clear() {
-        while (!empty()) {
-            dequeue();
-        }
+        destroy(0, _size);
+        _head = 0;
+        _size = 0;
     }
 
     // 遍历输出队列元素（从队首到队尾）
     void print() const {
-        Node* p = frontNode;
-        while (p) {
-            cout << p->data << " ";
-            p = p->next;
+        for (int i = 0; i < _size; i++) {
+            cout << _elem[slot(i)] << " ";
         }
         cout << endl;
     }
@@ -0,0 +1,106 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+#include <iostream>
+#include <cstdlib>
+#include <cstddef>
+#include <atomic>
+using namespace std;
+
+#ifndef CACHE_LINE_SIZE
+#define CACHE_LINE_SIZE 64 // 缓存行大小
+#endif
+
+// 单生产者/单消费者有界环形队列（无锁、无等待）：
+// 恰好一个线程调用push、另一个线程调用pop；容量取2的幂，以掩码定位
+// 生产者独占_tail、消费者独占_head，二者分处不同缓存行以免伪共享；
+// 各方另缓存对方下标，仅在缓存值显示队满/队空时才重新读取对方的原子下标，减少跨核缓存行往返
+template <typename T> class SpscQueue {
+private:
+    T* _elem;         // 环形数据区（构造后只读）
+    size_t _mask;     // 容量 - 1
+
+    alignas(CACHE_LINE_SIZE) atomic<size_t> _tail; // 下一个写入位置（生产者写）
+    size_t _headCache;                             // 生产者所见的_head
+
+    alignas(CACHE_LINE_SIZE) atomic<size_t> _head; // 下一个读取位置（消费者写）
+    size_t _tailCache;                             // 消费者所见的_tail
+
+    // 生产者：可写入的空位数（不足n时才刷新_headCache）
+    size_t freeSlots(size_t tail, size_t n) {
+        size_t cap = _mask + 1;
+        if (cap - (tail - _headCache) < n)
+            _headCache = _head.load(memory_order_acquire);
+        return cap - (tail - _headCache);
+    }
+
+    // 消费者：可读取的元素数（不足n时才刷新_tailCache）
+    size_t readySlots(size_t head, size_t n) {
+        if (_tailCache - head < n)
+            _tailCache = _tail.load(memory_order_acquire);
+        return _tailCache - head;
+    }
+
+    SpscQueue(SpscQueue<T> const&);            // 禁止复制
+    SpscQueue<T>& operator=(SpscQueue<T> const&);
+
+public:
+    // 构造函数：容量取不小于c的2的幂
+    explicit SpscQueue(int c = 1024) : _tail(0), _headCache(0), _head(0), _tailCache(0) {
+        size_t capacity = 2;
+        while (capacity < (size_t)c) capacity <<= 1;
+        _elem = new T[capacity];
+        _mask = capacity - 1;
+    }
+
+    // 析构函数
+    ~SpscQueue() { delete[] _elem; }
+
+    int capacity() const { return (int)(_mask + 1); }
+    // 规模（另一方并发修改时仅为近似值）
+    int size() const { return (int)(_tail.load(memory_order_acquire) - _head.load(memory_order_acquire)); }
+    bool empty() const { return size() == 0; }
+
+    // 入队（仅生产者调用）：队满则返回false
+    bool push(T const& e) {
+        size_t tail = _tail.load(memory_order_relaxed);
+        if (freeSlots(tail, 1) < 1) return false;
+        _elem[tail & _mask] = e;
+        _tail.store(tail + 1, memory_order_release);
+        return true;
+    }
+
+    // 批量入队（仅生产者调用）：A[0..n)中能放下的前若干个依次入队，一次发布，返回实际个数
+    int push(T const* A, int n) {
+        if (n < 1) return 0;
+        size_t tail = _tail.load(memory_order_relaxed);
+        size_t k = freeSlots(tail, n);
+        if (k > (size_t)n) k = n;
+        for (size_t i = 0; i < k; i++) _elem[(tail + i) & _mask] = A[i];
+        if (k) _tail.store(tail + k, memory_order_release);
+        return (int)k;
+    }
+
+    // 出队（仅消费者调用）：队空则返回false
+    bool pop(T& e) {
+        size_t head = _head.load(memory_order_relaxed);
+        if (readySlots(head, 1) < 1) return false;
+        e = _elem[head & _mask];
+        _head.store(head + 1, memory_order_release);
+        return true;
+    }
+
+    // 批量出队（仅消费者调用）：至多n个元素依次存入A，一次归还空位，返回实际个数
+    int pop(T* A, int n) {
+        if (n < 1) return 0;
+        size_t head = _head.load(memory_order_relaxed);
+        size_t k = readySlots(head, n);
+        if (k > (size_t)n) k = n;
+        for (size_t i = 0; i < k; i++) A[i] = _elem[(head + i) & _mask];
+        if (k) _head.store(head + k, memory_order_release);
+        return (int)k;
+    }
+};
+
+
+
+#endif  // SPSC_QUEUE_H
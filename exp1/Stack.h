@@ -2,75 +2,85 @@
 #define STACK_H
 #include <iostream>
 #include <cstdlib>
+#include <cstring>
+#include <type_traits>
+#include <new>
+#include <utility>
 using namespace std;
 
+// 顺序栈：元素连续存放于数组中（栈底在_elem[0]），容量按倍增分摊扩充
+// 数据区为未初始化的原始内存：元素入栈时才构造、出栈或清空时即析构，故T无需可默认构造
 template <typename T> class Stack {
 private:
-    struct Node {
-        T data;     
-        Node* next;   
-
-        Node(T const& e, Node* n = nullptr) : data(e), next(n) {}
-    };
-
-    Node* top; 
-    int _size;  
+    T* _elem;       // 数据区（仅[0, _size)中的元素已构造）
+    int _size;      // 规模
+    int _capacity;  // 容量
+
+    // 复制s的全部元素（须已为空；平凡可复制类型整块memcpy）
+    void copyFrom(Stack<T> const& s) {
+        reserve(s._size);
+        if (is_trivially_copyable<T>::value) {
+            if (s._size) memcpy((void*)_elem, (void const*)s._elem, s._size * sizeof(T));
+        } else {
+            for (int i = 0; i < s._size; i++) new (_elem + i) T(s._elem[i]);
+        }
+        _size = s._size;
+    }
 
 public:
     // 构造函数
-    Stack() : top(nullptr), _size(0) {}
+    Stack() : _elem(nullptr), _size(0), _capacity(0) {}
 
     // 析构函数
     ~Stack() {
-        while (!empty()) {
-            pop();
-        }
+        clear();
+        ::operator delete(_elem);
     }
 
     // 拷贝构造函数
-    Stack(Stack<T> const& s) {
-        top = nullptr;
-        _size = 0;
-        Node* p = s.top;
-
-        Stack<T> temp;
-        while (p) {
-            temp.push(p->data);
-            p = p->next;
-        }
-
-        while (!temp.empty()) {
-            push(temp.pop());
-        }
+    Stack(Stack<T> const& s) : _elem(nullptr), _size(0), _capacity(0) {
+        copyFrom(s);
     }
 
     // 赋值运算符
     Stack<T>& operator=(Stack<T> const& s) {
         if (this != &s) {
-            // 清空当前栈
-            while (!empty()) {
-                pop();
-            }
-            // 拷贝元素
-            Node* p = s.top;
-            Stack<T> temp;
-            while (p) {
-                temp.push(p->data);
-                p = p->next;
-            }
-            while (!temp.empty()) {
-                push(temp.pop());
-            }
+            clear();
+            copyFrom(s);
         }
         return *this;
     }
 
     int size() const { return _size; }        
     bool empty() const { return _size == 0; } 
+    int capacity() const { return _capacity; }
+
+    // 预留容量：确保至少可容纳c个元素而无需再扩容
+    void reserve(int c) {
+        if (c <= _capacity) return;
+        T* oldElem = _elem;
+        _elem = static_cast<T*>(::operator new(c * sizeof(T)));
+        _capacity = c;
+        if (is_trivially_copyable<T>::value) {
+            if (_size) memcpy((void*)_elem, (void const*)oldElem, _size * sizeof(T));
+        } else {
+            for (int i = 0; i < _size; i++) { // 逐个移入新数据区，并析构旧元素
+                new (_elem + i) T(std::move(oldElem[i]));
+                oldElem[i].~T();
+            }
+        }
+        ::operator delete(oldElem);
+    }
 
-    // 入栈：在栈顶插入元素
+    // 入栈：在栈顶插入元素（满则容量加倍）
     void push(T const& e) {
-        top = new Node(e, top);
+        if (_size == _capacity) { // e可能引用栈内元素，须在扩容（旧数据区释放）前复制
+            T x(e);
+            reserve(_capacity < 8 ? 8 : _capacity << 1);
+            new (_elem + _size) T(std::move(x));
+        } else {
+            new (_elem + _size) T(e);
+        }
         _size++;
     }
 
@@ -80,11 +90,8 @@ public:
             cerr << "栈为空，无法执行pop操作！" << endl;
             exit(EXIT_FAILURE);
         }
-        Node* oldTop = top;
-        T e = oldTop->data;
-        top = top->next;
-        delete oldTop;
-        _size--;
+        T e = std::move(_elem[--_size]);
+        _elem[_size].~T();
         return e;
     }
 
@@ -94,24 +101,22 @@ public:
             cerr << "栈为空，无法执行peek操作！" << endl;
             exit(EXIT_FAILURE);
         }
-        return top->data;
+        return _elem[_size - 1];
     }
 
     // 遍历输出栈元素（从栈顶到栈底）
     void print() const {
-        Node* p = top;
-        while (p) {
-            cout << p->data << " ";
-            p = p->next;
+        for (int i = _size - 1; i >= 0; i--) {
+            cout << _elem[i] << " ";
         }
         cout << endl;
     }
 
-    // 清空栈
+    // 清空栈：析构全部元素，保留已分配的容量
     void clear() {
-        while (!empty()) {
-            pop();
-        }
+        if (!is_trivially_destructible<T>::value)
+            for (int i = 0; i < _size; i++) _elem[i].~T();
+        _size = 0;
     }
 };
 
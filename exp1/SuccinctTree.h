@@ -0,0 +1,290 @@
+#ifndef SUCCINCT_TREE_H
+#define SUCCINCT_TREE_H
+#include <iostream>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <climits>
+#include <type_traits>
+#include "Tree.h"
+#include "Queue.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+using namespace std;
+
+typedef uint32_t SuccinctNode; // 节点编号（即层序序号，根为0）
+#define NIL_SUCCINCT ((SuccinctNode)-1) // 空节点
+
+// 静态简洁二叉树（二叉LOUDS表示）：将Tree<T>按层序冻结为2n位的位序列B加上层序排列的数据数组
+//   B[2v]、B[2v+1]分别表示节点v是否有左、右孩子
+//   B中每个1依次对应层序编号为1, 2, ...的节点，故：
+//     左孩子 = rank1(2v) + 1，右孩子 = rank1(2v + 1) + 1（rank1(p)为B[0, p)中1的个数）
+//     父亲   = select1(v) / 2（select1(k)为第k个1的位置）
+// rank借助每512位一个的累计计数在O(1)内完成；select先按采样定位块，再在块内扫描
+// 全部数据（文件头、位序列、计数表、采样表、数据数组）连续存放于一块内存，与文件格式逐字节一致，
+// 故save即整块写出，load即整块映射（mmap），无需逐节点重建；T须可平凡复制
+template <typename T> class SuccinctTree {
+private:
+    static_assert(is_trivially_copyable<T>::value, "SuccinctTree的数据类型须可平凡复制");
+
+    static const uint64_t WORDS_PER_BLOCK = 8;   // 每块8个64位字（512位）
+    static const uint64_t SAMPLE_RATE = 512;     // 每512个1采样一次所在块
+
+    struct Header {
+        char magic[8];       // "SUCTREE1"
+        uint64_t n;          // 节点数
+        uint64_t nwords;     // 位序列所占64位字数
+        uint64_t nblocks;    // 块数
+        uint64_t nsamples;   // select采样数
+        uint64_t dataSize;   // sizeof(T)，加载时校验
+        uint64_t bytes;      // 整块总字节数
+        uint64_t reserved;
+    };
+
+    char* _buf;              // 整块数据
+    size_t _bytes;
+    bool _mapped;            // _buf是否为文件映射（否则为堆内存）
+#ifdef _WIN32
+    HANDLE _file, _mapping;
+#endif
+    Header* _header;
+    uint64_t* _words;        // 位序列B
+    uint64_t* _blockRank;    // _blockRank[b]：第b块之前1的个数（共nblocks + 1项）
+    uint64_t* _samples;      // _samples[j]：第j * SAMPLE_RATE + 1个1所在的块
+    T* _data;                // 层序数据数组
+
+    static size_t align8(size_t x) { return (x + 7) & ~(size_t)7; }
+
+    // 按头部信息计算各段在整块中的偏移，并设置各指针
+    void locate() {
+        _header = reinterpret_cast<Header*>(_buf);
+        char* p = _buf + sizeof(Header);
+        _words = reinterpret_cast<uint64_t*>(p);     p += _header->nwords * 8;
+        _blockRank = reinterpret_cast<uint64_t*>(p); p += (_header->nblocks + 1) * 8;
+        _samples = reinterpret_cast<uint64_t*>(p);   p += _header->nsamples * 8;
+        _data = reinterpret_cast<T*>(p);
+    }
+
+    static size_t layoutBytes(uint64_t n, uint64_t nwords, uint64_t nblocks, uint64_t nsamples) {
+        return sizeof(Header) + (nwords + nblocks + 1 + nsamples) * 8 + align8(n * sizeof(T));
+    }
+
+    // n个节点时位序列字数、块数与采样数（build据此分配，load据此校验文件头）
+    static void geometry(uint64_t n, uint64_t& nwords, uint64_t& nblocks, uint64_t& nsamples) {
+        nwords = (2 * n + 63) / 64 + 1;                   // 多留一字，rank1(2n)时不越界
+        nblocks = (nwords + WORDS_PER_BLOCK - 1) / WORDS_PER_BLOCK;
+        nsamples = n / SAMPLE_RATE + 1;                   // 1的个数为n - 1
+    }
+
+    // 建立计数表与采样表（build时写入），或与映射中已有者逐项核对（load时校验，映射只读故不写入）
+    bool buildIndex(bool verify) {
+        uint64_t nwords = _header->nwords, nblocks = _header->nblocks, ones = 0;
+        for (uint64_t b = 0; b <= nblocks; b++) { // 末项_blockRank[nblocks]为1的总数
+            if (!verify) _blockRank[b] = ones;
+            else if (_blockRank[b] != ones) return false;
+            for (uint64_t w = b * WORDS_PER_BLOCK; w < (b + 1) * WORDS_PER_BLOCK && w < nwords; w++) {
+                uint64_t c = __builtin_popcountll(_words[w]);
+                for (uint64_t k = ones + 1; k <= ones + c; k++) { // 本字内的1中恰为采样点者
+                    if ((k - 1) % SAMPLE_RATE != 0) continue;
+                    uint64_t j = (k - 1) / SAMPLE_RATE;
+                    if (j >= _header->nsamples) return false;
+                    if (!verify) _samples[j] = b;
+                    else if (_samples[j] != b) return false;
+                }
+                ones += c;
+            }
+        }
+        return true;
+    }
+
+    // 位序列是否描述一棵n个节点的二叉树：1恰有n - 1个，且B[2n]及其后全为0（导航不会越出_data）
+    bool wellFormed() const {
+        uint64_t n = _header->n, nbits = 2 * n;
+        if (_blockRank[_header->nblocks] != (n ? n - 1 : 0)) return false;
+        for (uint64_t p = nbits; p < _header->nwords * 64; p++)
+            if (bit(p)) return false;
+        return true;
+    }
+
+    bool bit(uint64_t p) const { return (_words[p >> 6] >> (p & 63)) & 1; }
+
+    // B[0, p)中1的个数
+    uint64_t rank1(uint64_t p) const {
+        uint64_t w = p >> 6, b = w / WORDS_PER_BLOCK;
+        uint64_t r = _blockRank[b];
+        for (uint64_t i = b * WORDS_PER_BLOCK; i < w; i++) r += __builtin_popcountll(_words[i]);
+        if (p & 63) r += __builtin_popcountll(_words[w] & ((uint64_t(1) << (p & 63)) - 1));
+        return r;
+    }
+
+    // 第k个1（k >= 1）的位置
+    uint64_t select1(uint64_t k) const {
+        uint64_t b = _samples[(k - 1) / SAMPLE_RATE];
+        while (_blockRank[b + 1] < k) b++;           // 定位块
+        k -= _blockRank[b];
+        uint64_t w = b * WORDS_PER_BLOCK;
+        for (;; w++) {                               // 定位字
+            uint64_t c = __builtin_popcountll(_words[w]);
+            if (k <= c) break;
+            k -= c;
+        }
+        uint64_t x = _words[w];
+        while (--k) x &= x - 1;                      // 去掉低位的k-1个1
+        return (w << 6) + __builtin_ctzll(x);
+    }
+
+    void release() {
+        if (!_buf) return;
+        if (_mapped) {
+#ifdef _WIN32
+            UnmapViewOfFile(_buf);
+            CloseHandle(_mapping);
+            CloseHandle(_file);
+#else
+            munmap(_buf, _bytes);
+#endif
+        } else {
+            delete[] reinterpret_cast<uint64_t*>(_buf);
+        }
+        _buf = nullptr;
+        _bytes = 0;
+        _mapped = false;
+    }
+
+    SuccinctTree(SuccinctTree<T> const&);            // 禁止复制
+    SuccinctTree<T>& operator=(SuccinctTree<T> const&);
+
+public:
+    // 构造函数
+    SuccinctTree() : _buf(nullptr), _bytes(0), _mapped(false) {}
+    SuccinctTree(Tree<T> const& tree) : _buf(nullptr), _bytes(0), _mapped(false) { build(tree); }
+
+    // 析构函数
+    ~SuccinctTree() { release(); }
+
+    // 由Tree<T>构建（层序一遍，再一遍建立计数表与采样表）
+    void build(Tree<T> const& tree) {
+        release();
+        uint64_t n = tree.size();
+        uint64_t nwords, nblocks, nsamples;
+        geometry(n, nwords, nblocks, nsamples);
+        _bytes = layoutBytes(n, nwords, nblocks, nsamples);
+        _buf = reinterpret_cast<char*>(new uint64_t[_bytes / 8]);
+        memset(_buf, 0, _bytes);
+        Header* h = reinterpret_cast<Header*>(_buf);
+        memcpy(h->magic, "SUCTREE1", 8);
+        h->n = n; h->nwords = nwords; h->nblocks = nblocks; h->nsamples = nsamples;
+        h->dataSize = sizeof(T); h->bytes = _bytes;
+        locate();
+
+        if (n) { // 层序遍历：依次写出数据与孩子位
+            Queue<decltype(tree.getRoot())> queue;
+            queue.enqueue(tree.getRoot());
+            for (uint64_t v = 0; !queue.empty(); v++) {
+                auto x = queue.dequeue();
+                _data[v] = x->data;
+                if (x->left) { _words[(2 * v) >> 6] |= uint64_t(1) << ((2 * v) & 63); queue.enqueue(x->left); }
+                if (x->right) { _words[(2 * v + 1) >> 6] |= uint64_t(1) << ((2 * v + 1) & 63); queue.enqueue(x->right); }
+            }
+        }
+        buildIndex(false);
+    }
+
+    // 整块写出至文件，成功返回true
+    bool save(char const* file) const {
+        if (!_buf) return false;
+        FILE* fp = fopen(file, "wb");
+        if (!fp) return false;
+        bool ok = fwrite(_buf, 1, _bytes, fp) == _bytes;
+        return (fclose(fp) == 0) && ok;
+    }
+
+    // 以只读方式映射文件（不复制、不重建），格式或数据类型不符则返回false
+    // 文件头中的各段长度须与n及文件长度吻合，计数表、采样表须与位序列一致，故截断或篡改的文件均被拒绝
+    bool load(char const* file) {
+        release();
+#ifdef _WIN32
+        _file = CreateFileA(file, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (_file == INVALID_HANDLE_VALUE) return false;
+        LARGE_INTEGER sz;
+        if (!GetFileSizeEx(_file, &sz) || sz.QuadPart < (LONGLONG)sizeof(Header)) { CloseHandle(_file); return false; }
+        _mapping = CreateFileMappingA(_file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (!_mapping) { CloseHandle(_file); return false; }
+        void* p = MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!p) { CloseHandle(_mapping); CloseHandle(_file); return false; }
+        _bytes = (size_t)sz.QuadPart;
+#else
+        int fd = open(file, O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(Header)) { close(fd); return false; }
+        void* p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd); // 映射建立后即可关闭文件描述符
+        if (p == MAP_FAILED) return false;
+        _bytes = (size_t)st.st_size;
+#endif
+        _buf = static_cast<char*>(p);
+        _mapped = true;
+        Header const* h = reinterpret_cast<Header const*>(_buf);
+        uint64_t nwords, nblocks, nsamples;
+        if (memcmp(h->magic, "SUCTREE1", 8) != 0 || h->dataSize != sizeof(T) || h->bytes != _bytes
+            || h->n > (uint64_t)INT_MAX) { // 节点编号为int；n有界，下面的长度计算亦不致溢出
+            release();
+            return false;
+        }
+        geometry(h->n, nwords, nblocks, nsamples);
+        if (h->nwords != nwords || h->nblocks != nblocks || h->nsamples != nsamples
+            || layoutBytes(h->n, nwords, nblocks, nsamples) != _bytes) {
+            release();
+            return false;
+        }
+        locate();
+        if (!buildIndex(true) || !wellFormed()) {
+            release();
+            return false;
+        }
+        return true;
+    }
+
+    // 基本操作
+    int size() const { return _buf ? (int)_header->n : 0; }
+    bool empty() const { return size() == 0; }
+    size_t bytes() const { return _bytes; } // 占用的总字节数
+
+    // 导航（均为O(1)，parent为近似O(1)）
+    SuccinctNode root() const { return empty() ? NIL_SUCCINCT : 0; }
+    SuccinctNode leftChild(SuccinctNode v) const {
+        return bit(2 * (uint64_t)v) ? (SuccinctNode)(rank1(2 * (uint64_t)v) + 1) : NIL_SUCCINCT;
+    }
+    SuccinctNode rightChild(SuccinctNode v) const {
+        return bit(2 * (uint64_t)v + 1) ? (SuccinctNode)(rank1(2 * (uint64_t)v + 1) + 1) : NIL_SUCCINCT;
+    }
+    SuccinctNode parent(SuccinctNode v) const {
+        return v == 0 ? NIL_SUCCINCT : (SuccinctNode)(select1(v) >> 1);
+    }
+    bool isLeftChild(SuccinctNode v) const { return v != 0 && (select1(v) & 1) == 0; }
+    SuccinctNode sibling(SuccinctNode v) const { // 兄弟（同一父亲的另一孩子）
+        if (v == 0) return NIL_SUCCINCT;
+        uint64_t p = select1(v);
+        uint64_t q = p ^ 1; // 父亲的另一孩子位
+        return bit(q) ? (SuccinctNode)(rank1(q) + 1) : NIL_SUCCINCT;
+    }
+    bool isLeaf(SuccinctNode v) const { return !bit(2 * (uint64_t)v) && !bit(2 * (uint64_t)v + 1); }
+    T const& data(SuccinctNode v) const { return _data[v]; }
+
+    // 层序遍历：即顺序扫描数据数组
+    void levelOrder(void (*visit)(T const&)) const {
+        for (int v = 0; v < size(); v++) visit(_data[v]);
+    }
+};
+
+
+
+#endif  // SUCCINCT_TREE_H
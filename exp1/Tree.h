@@ -1,6 +1,12 @@
 #ifndef TREE_H
 #define TREE_H
 #include <iostream>
+#include <type_traits>
+#include <iterator>
+#include <cstddef>
+#include "Stack.h"
+#include "Queue.h"
+#include "ForkJoinPool.h" // 并行操作所需的线程池（基于<thread>），使用本头文件须以-pthread编译链接
 using namespace std;
 
 template <typename T> class Tree {
@@ -11,31 +17,132 @@ private:
         Node* left;     
         Node* right;  
         Node* parent;   
+        int order;      // 先序编号（仅供祖先索引使用）
 
         // 节点构造函数
         Node(T const& e, Node* p = nullptr, Node* l = nullptr, Node* r = nullptr)
-            : data(e), parent(p), left(l), right(r) {}
+            : data(e), parent(p), left(l), right(r), order(-1) {}
+    };
+
+    // 祖先索引：按先序编号存放各节点的深度、子树规模与父亲，另建稀疏表与按深度分桶的先序编号表
+    // 节点u是v的祖先 当且仅当 order(u) <= order(v) < order(u) + size(u)
+    // u != v且order(u) < order(v)时，先序区间(order(u), order(v)]中深度最小者的父亲即为LCA（稀疏表O(1)求得）
+    // v的k级祖先即深度为depth(v) - k的节点中先序编号不超过order(v)的最后一个（二分查找，O(log n)）
+    struct AncestorIndex {
+        int n, levels;
+        Node** node;      // node[i]：先序编号为i的节点
+        int* depth;       // depth[i]：深度（根为0）
+        int* size;        // size[i]：子树规模
+        int* parent;      // parent[i]：父亲的先序编号（根为-1）
+        int* table;       // table[j * n + i]：先序区间[i, i + 2^j)中深度最小者的编号
+        int* levelStart;  // 深度d的节点在levelOrder中占[levelStart[d], levelStart[d + 1])
+        int* levelOrder;  // 按深度分桶、桶内按先序排列的先序编号
+
+        AncestorIndex(Node* root, int n) : n(n), levels(1) {
+            while ((1 << levels) <= n) levels++;
+            node = new Node*[n]; depth = new int[n]; size = new int[n]; parent = new int[n];
+            table = new int[(size_t)levels * n];
+            Stack<Node*> stack; // 先序编号
+            int k = 0, maxDepth = 0;
+            stack.push(root);
+            while (!stack.empty()) {
+                Node* x = stack.pop();
+                x->order = k;
+                node[k] = x;
+                parent[k] = x->parent ? x->parent->order : -1;
+                depth[k] = x->parent ? depth[parent[k]] + 1 : 0;
+                if (maxDepth < depth[k]) maxDepth = depth[k];
+                size[k++] = 1;
+                if (x->right) stack.push(x->right);
+                if (x->left) stack.push(x->left);
+            }
+            for (int i = n - 1; 0 < i; i--) size[parent[i]] += size[i]; // 子节点编号恒大于父亲
+            for (int i = 0; i < n; i++) table[i] = i;                    // 第0层即自身
+            for (int j = 1; j < levels; j++) {
+                int* prev = table + (size_t)(j - 1) * n;
+                int* curr = table + (size_t)j * n;
+                for (int i = 0; i + (1 << j) <= n; i++) {
+                    int a = prev[i], b = prev[i + (1 << (j - 1))];
+                    curr[i] = depth[b] < depth[a] ? b : a;
+                }
+            }
+            levelStart = new int[maxDepth + 2]();
+            levelOrder = new int[n];
+            for (int i = 0; i < n; i++) levelStart[depth[i] + 1]++;
+            for (int d = 0; d <= maxDepth; d++) levelStart[d + 1] += levelStart[d];
+            int* fill = new int[maxDepth + 1];
+            for (int d = 0; d <= maxDepth; d++) fill[d] = levelStart[d];
+            for (int i = 0; i < n; i++) levelOrder[fill[depth[i]]++] = i; // 按先序扫描，桶内自然有序
+            delete[] fill;
+        }
+        ~AncestorIndex() {
+            delete[] node; delete[] depth; delete[] size; delete[] parent;
+            delete[] table; delete[] levelStart; delete[] levelOrder;
+        }
+
+        bool isAncestor(int u, int v) const { return u <= v && v < u + size[u]; }
+
+        int lca(int u, int v) const {
+            if (u == v) return u;
+            if (v < u) { int t = u; u = v; v = t; }
+            if (v < u + size[u]) return u; // u为v的祖先
+            int lo = u + 1, j = 31 - __builtin_clz(v - u);
+            int const* row = table + (size_t)j * n;
+            int a = row[lo], b = row[v + 1 - (1 << j)];
+            return parent[depth[b] < depth[a] ? b : a];
+        }
+
+        int ancestor(int v, int k) const {
+            int d = depth[v] - k;
+            if (k < 0 || d < 0) return -1;
+            int lo = levelStart[d], hi = levelStart[d + 1]; // 于[lo, hi)中找最后一个不超过v者
+            while (lo + 1 < hi) {
+                int mi = (lo + hi) >> 1;
+                if (levelOrder[mi] <= v) lo = mi; else hi = mi;
+            }
+            return levelOrder[lo];
+        }
     };
 
     Node* root; 
     int _size; 
+    mutable AncestorIndex* _index; // 祖先索引（惰性构建，树的结构一经修改即作废）
 
-    // 辅助函数：递归销毁节点
+    // 辅助函数：销毁以node为根的子树（后序逐个删除叶节点并沿parent回溯，O(1)额外空间，深树亦不致栈溢出）
     void destroy(Node* node) {
-        if (node) {
-            destroy(node->left);  
-            destroy(node->right);  
-            delete node;         
+        Node* x = node;
+        while (x) {
+            if (x->left) x = x->left;
+            else if (x->right) x = x->right;
+            else {
+                Node* p = (x == node) ? nullptr : x->parent; // 不越出子树
+                if (p) (p->left == x ? p->left : p->right) = nullptr;
+                delete x;
+                x = p;
+            }
         }
     }
 
-    // 辅助函数：递归拷贝树
+    // 辅助函数：拷贝以orig为根的子树（原树与副本同步先序下行、沿parent回溯，O(1)额外空间）
     Node* copy(Node* orig, Node* parent) {
         if (!orig) return nullptr;
-        Node* newNode = new Node(orig->data, parent);
-        newNode->left = copy(orig->left, newNode);   
-        newNode->right = copy(orig->right, newNode);
-        return newNode;
+        Node* newRoot = new Node(orig->data, parent);
+        Node* o = orig;
+        Node* c = newRoot;
+        while (true) {
+            if (o->left && !c->left) {
+                c->left = new Node(o->left->data, c);
+                o = o->left; c = c->left;
+            } else if (o->right && !c->right) {
+                c->right = new Node(o->right->data, c);
+                o = o->right; c = c->right;
+            } else if (o == orig) {
+                break;
+            } else {
+                o = o->parent; c = c->parent;
+            }
+        }
+        return newRoot;
     }
 
     // 递归先序遍历
@@ -65,97 +172,187 @@ private:
         }
     }
 
-    // 非递归先序遍历（手工模拟栈）
+    // 非递归先序遍历（借助可扩容的顺序栈）
     void preOrderIter(Node* node, void (*visit)(T&)) const {
         if (!node) return;
-        // 手工实现栈（固定大小，实际可动态扩容，此处简化）
-        Node* stack[100];
-        int top = -1;
-        stack[++top] = node; 
+        Stack<Node*> stack;
+        stack.push(node);
 
-        while (top != -1) {   
-            Node* curr = stack[top--];  
-            visit(curr->data);         
+        while (!stack.empty()) {
+            Node* curr = stack.pop();
+            visit(curr->data);
 
             // 右孩子先入栈
-            if (curr->right) stack[++top] = curr->right;
-            if (curr->left) stack[++top] = curr->left;
+            if (curr->right) stack.push(curr->right);
+            if (curr->left) stack.push(curr->left);
         }
     }
 
-    // 非递归中序遍历（手工模拟栈）
+    // 非递归中序遍历（借助可扩容的顺序栈）
     void inOrderIter(Node* node, void (*visit)(T&)) const {
         if (!node) return;
-        Node* stack[100];
-        int top = -1;
+        Stack<Node*> stack;
         Node* curr = node;
 
-        while (top != -1 || curr) {
+        while (!stack.empty() || curr) {
             // 左子树全入栈
             while (curr) {
-                stack[++top] = curr;
+                stack.push(curr);
                 curr = curr->left;
             }
             // 出栈并访问
-            curr = stack[top--];
+            curr = stack.pop();
             visit(curr->data);
 
             curr = curr->right;
         }
     }
 
-    // 非递归后序遍历（手工模拟栈，记录访问标记）
+    // 非递归后序遍历（借助可扩容的顺序栈，记录上一个访问的节点）
     void postOrderIter(Node* node, void (*visit)(T&)) const {
         if (!node) return;
-        Node* stack[100];
-        bool visited[100] = {false}; 
-        int top = -1;
-        stack[++top] = node;
-
-        while (top != -1) {
-            Node* curr = stack[top];
-            if (visited[top]) {     
-                top--;
-                visit(curr->data);  
+        Stack<Node*> stack;
+        Node* curr = node;
+        Node* last = nullptr; // 上一个访问的节点
+
+        while (!stack.empty() || curr) {
+            // 左子树全入栈
+            while (curr) {
+                stack.push(curr);
+                curr = curr->left;
+            }
+            Node* top = stack.peek();
+            if (top->right && top->right != last) {
+                curr = top->right; // 右子树尚未访问，转入右子树
             } else {
-                visited[top] = true; 
-                // 右、左子树入栈（保证左先于右处理）
-                if (curr->right) {
-                    stack[++top] = curr->right;
-                    visited[top] = false;
-                }
-                if (curr->left) {
-                    stack[++top] = curr->left;
-                    visited[top] = false;
-                }
+                stack.pop();
+                visit(top->data);
+                last = top;
             }
         }
     }
 
-    // 层序遍历（手工模拟队列）
+    // 层序遍历（借助可扩容的循环队列）
     void levelOrderIter(Node* node, void (*visit)(T&)) const {
         if (!node) return;
-        // 手工实现队列（固定大小，循环队列逻辑）
-        Node* queue[100];
-        int front = 0, rear = 0;
-        queue[rear++] = node; 
+        Queue<Node*> queue;
+        queue.enqueue(node);
 
-        while (front != rear) { 
-            Node* curr = queue[front++]; 
-            visit(curr->data);  
+        while (!queue.empty()) {
+            Node* curr = queue.dequeue();
+            visit(curr->data);
 
-            if (curr->left) queue[rear++] = curr->left;
-            if (curr->right) queue[rear++] = curr->right;
+            if (curr->left) queue.enqueue(curr->left);
+            if (curr->right) queue.enqueue(curr->right);
         }
     }
 
+    // 无栈中序遍历：沿parent指针回溯，O(1)额外空间，且不像Morris遍历那样临时改写孩子指针
+    void inOrderStackless(Node* node, void (*visit)(T&)) const {
+        if (!node) return;
+        Node* stop = node->parent; // 子树之外的边界
+        Node* curr = node;
+        while (curr->left) curr = curr->left;
+        while (curr != stop) {
+            visit(curr->data);
+            if (curr->right) { // 后继为右子树中的最左者
+                curr = curr->right;
+                while (curr->left) curr = curr->left;
+            } else { // 后继为首个“自其左子树返回”的祖先
+                Node* child = curr;
+                curr = curr->parent;
+                while (curr != stop && curr->right == child) {
+                    child = curr;
+                    curr = curr->parent;
+                }
+            }
+        }
+    }
+
+    // 无栈先序遍历：沿parent指针回溯，O(1)额外空间
+    void preOrderStackless(Node* node, void (*visit)(T&)) const {
+        if (!node) return;
+        Node* stop = node->parent;
+        Node* curr = node;
+        while (curr != stop) {
+            visit(curr->data);
+            if (curr->left) { curr = curr->left; continue; }
+            if (curr->right) { curr = curr->right; continue; }
+            // 叶子：回溯至首个“自左子树返回且有右孩子”的祖先，转入其右子树
+            Node* child = curr;
+            curr = curr->parent;
+            while (curr != stop && (curr->right == child || !curr->right)) {
+                child = curr;
+                curr = curr->parent;
+            }
+            if (curr != stop) curr = curr->right;
+        }
+    }
+
+    // 并行辅助：子树深度未达cutoff时，左右子树作为两个任务并行处理，此后转为串行
+    // 合并次序只取决于树形与cutoff，与线程数及调度无关，故结果确定
+    template <typename R, typename Map, typename Combine>
+    R reduce(ForkJoinPool& pool, Node* node, R const& identity, Map& map, Combine& combine, int cutoff) const {
+        if (!node) return identity;
+        if (cutoff <= 0) { // 串行：按先序自左向右累积
+            R acc = identity;
+            Stack<Node*> stack;
+            stack.push(node);
+            while (!stack.empty()) {
+                Node* curr = stack.pop();
+                acc = combine(acc, map(curr->data));
+                if (curr->right) stack.push(curr->right);
+                if (curr->left) stack.push(curr->left);
+            }
+            return acc;
+        }
+        R left = identity, right = identity;
+        pool.join([&] { left = reduce(pool, node->left, identity, map, combine, cutoff - 1); },
+                  [&] { right = reduce(pool, node->right, identity, map, combine, cutoff - 1); });
+        return combine(combine(map(node->data), left), right);
+    }
+
+    Node* copy(ForkJoinPool& pool, Node* orig, Node* parent, int cutoff) {
+        if (!orig) return nullptr;
+        if (cutoff <= 0) return copy(orig, parent);
+        Node* newNode = new Node(orig->data, parent);
+        pool.join([&] { newNode->left = copy(pool, orig->left, newNode, cutoff - 1); },
+                  [&] { newNode->right = copy(pool, orig->right, newNode, cutoff - 1); });
+        return newNode;
+    }
+
+    void destroy(ForkJoinPool& pool, Node* node, int cutoff) {
+        if (!node) return;
+        if (cutoff <= 0) { destroy(node); return; }
+        Node* l = node->left;
+        Node* r = node->right;
+        delete node;
+        pool.join([&] { destroy(pool, l, cutoff - 1); }, [&] { destroy(pool, r, cutoff - 1); });
+    }
+
+    AncestorIndex const& index() const {
+        if (!_index) _index = new AncestorIndex(root, _size);
+        return *_index;
+    }
+    void invalidateIndex() {
+        delete _index;
+        _index = nullptr;
+    }
+
+    // 调用visit：visit返回bool时以其返回值决定是否继续遍历，返回void时恒继续
+    template <typename F> static bool proceed(F& visit, T& e, true_type) { visit(e); return true; }
+    template <typename F> static bool proceed(F& visit, T& e, false_type) { return visit(e) ? true : false; }
+    template <typename F> static bool apply(F& visit, T& e) {
+        return proceed(visit, e, typename is_void<decltype(visit(e))>::type());
+    }
+
 public:
     // 构造函数
-    Tree() : root(nullptr), _size(0) {}
-    Tree(T const& rootData) : root(new Node(rootData)), _size(1) {}
+    Tree() : root(nullptr), _size(0), _index(nullptr) {}
+    Tree(T const& rootData) : root(new Node(rootData)), _size(1), _index(nullptr) {}
 
     // 拷贝构造函数
-    Tree(Tree<T> const& tree) {
+    Tree(Tree<T> const& tree) : _index(nullptr) {
         root = copy(tree.root, nullptr);
         _size = tree._size;
     }
@@ -194,6 +391,7 @@ public:
         }
         parent->left = new Node(e, parent);
         _size++;
+        invalidateIndex();
         return parent->left;
     }
 
@@ -205,11 +403,13 @@ public:
         }
         parent->right = new Node(e, parent);
         _size++;
+        invalidateIndex();
         return parent->right;
     }
 
     // 清空树
     void clear() {
+        invalidateIndex();
         destroy(root);
         root = nullptr;
         _size = 0;
@@ -226,6 +426,157 @@ public:
     void postOrderIter(void (*visit)(T&)) const { postOrderIter(root, visit); }
     void levelOrder(void (*visit)(T&)) const { levelOrderIter(root, visit); }
 
+    // 遍历操作（无栈版，借助parent指针，不分配任何空间）
+    void preOrderStackless(void (*visit)(T&)) const { preOrderStackless(root, visit); }
+    void inOrderStackless(void (*visit)(T&)) const { inOrderStackless(root, visit); }
+
+    // 遍历操作（函数对象版）：visit的类型为模板参数，调用可在编译期内联
+    // visit可返回void，或返回bool：返回false即提前终止遍历；遍历完整结束时返回true，被终止时返回false
+    template <typename F> bool preOrder(F&& visit) const {
+        if (!root) return true;
+        Stack<Node*> stack;
+        stack.push(root);
+        while (!stack.empty()) {
+            Node* curr = stack.pop();
+            if (!apply(visit, curr->data)) return false;
+            if (curr->right) stack.push(curr->right);
+            if (curr->left) stack.push(curr->left);
+        }
+        return true;
+    }
+
+    template <typename F> bool inOrder(F&& visit) const {
+        Stack<Node*> stack;
+        Node* curr = root;
+        while (!stack.empty() || curr) {
+            while (curr) {
+                stack.push(curr);
+                curr = curr->left;
+            }
+            curr = stack.pop();
+            if (!apply(visit, curr->data)) return false;
+            curr = curr->right;
+        }
+        return true;
+    }
+
+    template <typename F> bool postOrder(F&& visit) const {
+        Stack<Node*> stack;
+        Node* curr = root;
+        Node* last = nullptr;
+        while (!stack.empty() || curr) {
+            while (curr) {
+                stack.push(curr);
+                curr = curr->left;
+            }
+            Node* top = stack.peek();
+            if (top->right && top->right != last) {
+                curr = top->right;
+            } else {
+                stack.pop();
+                if (!apply(visit, top->data)) return false;
+                last = top;
+            }
+        }
+        return true;
+    }
+
+    template <typename F> bool levelOrder(F&& visit) const {
+        if (!root) return true;
+        Queue<Node*> queue;
+        queue.enqueue(root);
+        while (!queue.empty()) {
+            Node* curr = queue.dequeue();
+            if (!apply(visit, curr->data)) return false;
+            if (curr->left) queue.enqueue(curr->left);
+            if (curr->right) queue.enqueue(curr->right);
+        }
+        return true;
+    }
+
+    // 并行操作：在pool中按子树派生任务，前cutoff层并行、其下各子树串行（cutoff宜取log2(线程数)再加3~4）
+    // 并行归约：各节点先取map(data)，再以combine合并（须满足结合律，identity为单位元）
+    template <typename R, typename Map, typename Combine>
+    R parallelReduce(ForkJoinPool& pool, R identity, Map map, Combine combine, int cutoff = 8) const {
+        R r = identity;
+        pool.invoke([&] { r = reduce(pool, root, identity, map, combine, cutoff); });
+        return r;
+    }
+
+    // 并行复制：以tree的副本替换当前树
+    void parallelCopy(Tree<T> const& tree, ForkJoinPool& pool, int cutoff = 8) {
+        if (this == &tree) return;
+        parallelClear(pool, cutoff);
+        pool.invoke([&] { root = copy(pool, tree.root, nullptr, cutoff); });
+        _size = tree._size;
+    }
+
+    // 并行清空
+    void parallelClear(ForkJoinPool& pool, int cutoff = 8) {
+        invalidateIndex();
+        pool.invoke([&] { destroy(pool, root, cutoff); });
+        root = nullptr;
+        _size = 0;
+    }
+
+    // 祖先查询：首次查询时以O(n log n)时间构建祖先索引，此后至下次修改树的结构之前均复用之
+    // LCA、isAncestor、depth为O(1)，k级祖先为O(log n)；节点须属于本树
+    // 索引的构建不加锁：多线程并发查询前，须先在单线程中调用buildAncestorIndex
+    void buildAncestorIndex() const { if (root) index(); }
+
+    bool isAncestor(Node* u, Node* v) const { // u是否为v的祖先（含u == v）
+        return index().isAncestor(u->order, v->order);
+    }
+    Node* lca(Node* u, Node* v) const {
+        AncestorIndex const& I = index();
+        return I.node[I.lca(u->order, v->order)];
+    }
+    int depth(Node* v) const { return index().depth[v->order]; }
+    Node* ancestor(Node* v, int k) const { // v的k级祖先（k = 0即v本身），不存在则返回nullptr
+        AncestorIndex const& I = index();
+        int a = I.ancestor(v->order, k);
+        return a < 0 ? nullptr : I.node[a];
+    }
+    int distance(Node* u, Node* v) const { // u与v之间的边数
+        AncestorIndex const& I = index();
+        int a = u->order, b = v->order;
+        return I.depth[a] + I.depth[b] - 2 * I.depth[I.lca(a, b)];
+    }
+
+    // 批量LCA：out[i] = lca(us[i], vs[i])，0 <= i < n
+    void lca(Node* const* us, Node* const* vs, Node** out, int n) const {
+        if (n <= 0) return;
+        AncestorIndex const& I = index();
+        for (int i = 0; i < n; i++) out[i] = I.node[I.lca(us[i]->order, vs[i]->order)];
+    }
+
+    // 批量LCA（并行版）：查询按grain个一组分派至pool；索引在分派前构建完毕，各组只读共享之
+    void lca(ForkJoinPool& pool, Node* const* us, Node* const* vs, Node** out, int n, int grain = 4096) const {
+        if (n <= 0) return;
+        AncestorIndex const& I = index();
+        if (grain < 1) grain = 1;
+        pool.invoke([&] {
+            TaskGroup g;
+            for (int lo = 0; lo < n; lo += grain) {
+                int hi = n - lo < grain ? n : lo + grain;
+                pool.spawn(g, [&, lo, hi] {
+                    for (int i = lo; i < hi; i++) out[i] = I.node[I.lca(us[i]->order, vs[i]->order)];
+                });
+            }
+            pool.wait(g);
+        });
+    }
+
+    // 批量距离：out[i] = distance(us[i], vs[i])
+    void distance(Node* const* us, Node* const* vs, int* out, int n) const {
+        if (n <= 0) return;
+        AncestorIndex const& I = index();
+        for (int i = 0; i < n; i++) {
+            int a = us[i]->order, b = vs[i]->order;
+            out[i] = I.depth[a] + I.depth[b] - 2 * I.depth[I.lca(a, b)];
+        }
+    }
+
     // 打印树（层序遍历）
     void print() const {
         cout << "层序遍历: ";
@@ -235,6 +586,112 @@ public:
 
     // 获取根节点（供测试用）
     Node* getRoot() const { return root; }
+
+private:
+    // 遍历次序下的首节点与后继：均借助parent指针，无需栈（nullptr表示遍历结束）
+    static Node* leftmost(Node* x) { while (x && x->left) x = x->left; return x; }
+    static Node* firstPost(Node* x) { // 后序首节点：尽量向左、无左则向右，直至叶子
+        while (x && (x->left || x->right)) x = x->left ? x->left : x->right;
+        return x;
+    }
+    static Node* preOrderNext(Node* x) {
+        if (x->left) return x->left;
+        if (x->right) return x->right;
+        Node* child = x;
+        for (x = x->parent; x; child = x, x = x->parent)
+            if (x->left == child && x->right) return x->right;
+        return nullptr;
+    }
+    static Node* inOrderNext(Node* x) {
+        if (x->right) return leftmost(x->right);
+        Node* child = x;
+        for (x = x->parent; x && x->right == child; child = x, x = x->parent);
+        return x;
+    }
+    static Node* postOrderNext(Node* x) {
+        Node* p = x->parent;
+        if (p && p->left == x && p->right) return firstPost(p->right);
+        return p;
+    }
+
+    struct PreOrderStep { static Node* first(Node* r) { return r; } static Node* next(Node* x) { return preOrderNext(x); } };
+    struct InOrderStep { static Node* first(Node* r) { return leftmost(r); } static Node* next(Node* x) { return inOrderNext(x); } };
+    struct PostOrderStep { static Node* first(Node* r) { return firstPost(r); } static Node* next(Node* x) { return postOrderNext(x); } };
+
+public:
+    // 惰性遍历迭代器（前向迭代器）：每次++只求出下一个节点，可随时停止，多个迭代器可交替推进
+    // 先/中/后序迭代器仅保存当前节点（沿parent指针求后继）；层序迭代器自带一个循环队列
+    // 迭代期间不得修改树的结构
+    template <typename Step> class TraversalIterator {
+    private:
+        Node* curr;
+    public:
+        typedef forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef ptrdiff_t difference_type;
+        typedef T* pointer;
+        typedef T& reference;
+
+        explicit TraversalIterator(Node* x = nullptr) : curr(x) {}
+        T& operator*() const { return curr->data; }
+        T* operator->() const { return &curr->data; }
+        TraversalIterator& operator++() { curr = Step::next(curr); return *this; }
+        TraversalIterator operator++(int) { TraversalIterator old = *this; ++*this; return old; }
+        bool operator==(TraversalIterator const& it) const { return curr == it.curr; }
+        bool operator!=(TraversalIterator const& it) const { return curr != it.curr; }
+    };
+    typedef TraversalIterator<PreOrderStep> PreOrderIterator;
+    typedef TraversalIterator<InOrderStep> InOrderIterator;
+    typedef TraversalIterator<PostOrderStep> PostOrderIterator;
+
+    class LevelOrderIterator {
+    private:
+        Queue<Node*> queue; // 队首即当前节点
+    public:
+        typedef forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef ptrdiff_t difference_type;
+        typedef T* pointer;
+        typedef T& reference;
+
+        explicit LevelOrderIterator(Node* x = nullptr) { if (x) queue.enqueue(x); }
+        T& operator*() const { return queue.front()->data; }
+        T* operator->() const { return &queue.front()->data; }
+        LevelOrderIterator& operator++() {
+            Node* x = queue.dequeue();
+            if (x->left) queue.enqueue(x->left);
+            if (x->right) queue.enqueue(x->right);
+            return *this;
+        }
+        LevelOrderIterator operator++(int) { LevelOrderIterator old = *this; ++*this; return old; }
+        bool operator==(LevelOrderIterator const& it) const { // 仅同为结束或当前节点相同时相等
+            if (queue.empty() || it.queue.empty()) return queue.empty() && it.queue.empty();
+            return queue.front() == it.queue.front();
+        }
+        bool operator!=(LevelOrderIterator const& it) const { return !(*this == it); }
+    };
+
+    // 迭代区间：供范围for使用，例如 for (int& e : tree.preOrderRange()) ...
+    template <typename It> struct Range {
+        It first, last;
+        It begin() const { return first; }
+        It end() const { return last; }
+    };
+    Range<PreOrderIterator> preOrderRange() const { Range<PreOrderIterator> r = { PreOrderIterator(PreOrderStep::first(root)), PreOrderIterator() }; return r; }
+    Range<InOrderIterator> inOrderRange() const { Range<InOrderIterator> r = { InOrderIterator(InOrderStep::first(root)), InOrderIterator() }; return r; }
+    Range<PostOrderIterator> postOrderRange() const { Range<PostOrderIterator> r = { PostOrderIterator(PostOrderStep::first(root)), PostOrderIterator() }; return r; }
+    Range<LevelOrderIterator> levelOrderRange() const { Range<LevelOrderIterator> r = { LevelOrderIterator(root), LevelOrderIterator() }; return r; }
+
+    // 默认迭代为中序
+    InOrderIterator begin() const { return InOrderIterator(InOrderStep::first(root)); }
+    InOrderIterator end() const { return InOrderIterator(); }
+
+    // 按先序查找首个满足pred者，找到即停止；无则返回nullptr
+    template <typename Pred> T* findFirst(Pred pred) const {
+        for (PreOrderIterator it(root); it != PreOrderIterator(); ++it)
+            if (pred(*it)) return &*it;
+        return nullptr;
+    }
 };
 
 // 遍历回调函数：打印节点数据
@@ -0,0 +1,111 @@
+#ifndef WORK_STEALING_DEQUE_H
+#define WORK_STEALING_DEQUE_H
+#include <iostream>
+#include <cstdlib>
+#include <atomic>
+using namespace std;
+
+// 工作窃取双端队列（Chase-Lev算法，按Lê等人的C11内存模型版本实现）：
+// 仅属主线程在底端push/take（无锁、通常无CAS），其他线程在顶端steal（以CAS争抢）
+// 数组满时倍增扩容；旧数组可能仍被窃取者读取，故挂入退役链表，待析构时统一释放
+// T须可平凡复制（通常为任务指针）
+template <typename T> class WorkStealingDeque {
+private:
+    struct Array {
+        long _capacity;     // 容量（2的幂）
+        atomic<T>* _elem;   // 环形数据区
+        Array* retired;     // 退役链表中的下一个旧数组
+
+        Array(long c, Array* r = nullptr) : _capacity(c), _elem(new atomic<T>[c]), retired(r) {}
+        ~Array() { delete[] _elem; }
+
+        T get(long i) const { return _elem[i & (_capacity - 1)].load(memory_order_relaxed); }
+        void put(long i, T e) { _elem[i & (_capacity - 1)].store(e, memory_order_relaxed); }
+    };
+
+    atomic<long> _top;       // 顶端（窃取端）
+    atomic<long> _bottom;    // 底端（属主端）
+    atomic<Array*> _array;   // 当前数组
+
+    // 扩容：复制[t, b)至容量加倍的新数组，旧数组退役
+    Array* grow(Array* a, long b, long t) {
+        Array* na = new Array(a->_capacity << 1, a);
+        for (long i = t; i < b; i++) na->put(i, a->get(i));
+        _array.store(na, memory_order_release);
+        return na;
+    }
+
+    WorkStealingDeque(WorkStealingDeque<T> const&);            // 禁止复制
+    WorkStealingDeque<T>& operator=(WorkStealingDeque<T> const&);
+
+public:
+    // 构造函数：初始容量取不小于c的2的幂
+    explicit WorkStealingDeque(long c = 64) : _top(0), _bottom(0) {
+        long capacity = 2;
+        while (capacity < c) capacity <<= 1;
+        _array.store(new Array(capacity), memory_order_relaxed);
+    }
+
+    // 析构函数（须确保已无其他线程访问）
+    ~WorkStealingDeque() {
+        Array* a = _array.load(memory_order_relaxed);
+        while (a) {
+            Array* r = a->retired;
+            delete a;
+            a = r;
+        }
+    }
+
+    // 规模（并发时仅为近似值）
+    long size() const {
+        long b = _bottom.load(memory_order_relaxed);
+        long t = _top.load(memory_order_relaxed);
+        return b > t ? b - t : 0;
+    }
+    bool empty() const { return size() == 0; }
+
+    // 属主：压入底端
+    void push(T e) {
+        long b = _bottom.load(memory_order_relaxed);
+        long t = _top.load(memory_order_acquire);
+        Array* a = _array.load(memory_order_relaxed);
+        if (b - t > a->_capacity - 1) a = grow(a, b, t);
+        a->put(b, e);
+        _bottom.store(b + 1, memory_order_release); // 发布e（及其所指对象），与steal中对_bottom的acquire读配对
+    }
+
+    // 属主：自底端取出（LIFO），空或与窃取者争抢最后一个元素失败则返回false
+    bool take(T& e) {
+        long b = _bottom.load(memory_order_relaxed) - 1;
+        Array* a = _array.load(memory_order_relaxed);
+        _bottom.store(b, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        long t = _top.load(memory_order_relaxed);
+        if (t > b) { // 已空
+            _bottom.store(b + 1, memory_order_release);
+            return false;
+        }
+        e = a->get(b);
+        if (t == b) { // 仅剩一个：与窃取者以CAS争抢
+            bool won = _top.compare_exchange_strong(t, t + 1, memory_order_seq_cst, memory_order_relaxed);
+            _bottom.store(b + 1, memory_order_release);
+            return won;
+        }
+        return true;
+    }
+
+    // 窃取者：自顶端窃取（FIFO），空或争抢失败则返回false
+    bool steal(T& e) {
+        long t = _top.load(memory_order_acquire);
+        atomic_thread_fence(memory_order_seq_cst);
+        long b = _bottom.load(memory_order_acquire);
+        if (t >= b) return false;
+        Array* a = _array.load(memory_order_acquire);
+        e = a->get(t);
+        return _top.compare_exchange_strong(t, t + 1, memory_order_seq_cst, memory_order_relaxed);
+    }
+};
+
+
+
+#endif  // WORK_STEALING_DEQUE_H
@@ -0,0 +1,529 @@
+// 并发容器实验：各容器的多线程压力测试（校验结果正确性）与吞吐量测量
+// 编译：g++ -std=c++11 -O2 -pthread main.cpp
+#include <iostream>
+#include <cstdlib>
+#include <chrono>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <mutex>
+#include <stdexcept>
+#include "../ConcurrentList.h"
+#include "../ConcurrentStack.h"
+#include "../Stack.h"
+#include "../SpscQueue.h"
+#include "../MpmcQueue.h"
+#include "../ForkJoinPool.h"
+
+using namespace std;
+
+static const int THREADS[] = {1, 2, 4, 8}; // 吞吐量测量所用的线程数
+static const int NTHREADS = sizeof(THREADS) / sizeof(THREADS[0]);
+
+// 校验失败即报错退出
+void check(bool ok, char const* what) {
+    if (!ok) {
+        cerr << "校验失败：" << what << endl;
+        exit(EXIT_FAILURE);
+    }
+}
+
+// 启动n个线程执行body(线程号)并等待全部结束，返回耗时（毫秒）
+template <typename F> double runThreads(int n, F body) {
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    vector<thread> pool;
+    for (int t = 0; t < n; t++) pool.push_back(thread(body, t));
+    for (int t = 0; t < n; t++) pool[t].join();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+// 线程私有的简单随机数（线性同余）
+unsigned nextRand(unsigned& seed) {
+    seed = seed * 1103515245 + 12345;
+    return seed >> 8;
+}
+
+// 延迟直方图：按log2分桶计数，第b桶收录[2^b, 2^(b+1))纳秒的样本
+struct LatencyHistogram {
+    static const int BUCKETS = 40;
+    long long count[BUCKETS];
+    long long total;
+
+    LatencyHistogram() : total(0) {
+        for (int b = 0; b < BUCKETS; b++) count[b] = 0;
+    }
+
+    void record(long long ns) {
+        int b = 0;
+        while (b < BUCKETS - 1 && (ns >> (b + 1)) > 0) b++;
+        count[b]++;
+        total++;
+    }
+
+    // 分位数的上界：至少p比例的样本不超过返回值（纳秒）
+    long long percentile(double p) const {
+        long long need = (long long)(p * total);
+        if (need < 1) need = 1;
+        long long seen = 0;
+        for (int b = 0; b < BUCKETS; b++)
+            if ((seen += count[b]) >= need) return 1LL << (b + 1);
+        return 1LL << BUCKETS;
+    }
+
+    // 输出各非空桶的计数及p50/p99/p999
+    void print() const {
+        for (int b = 0; b < BUCKETS; b++)
+            if (count[b]) cout << "    [" << (1LL << b) << ", " << (1LL << (b + 1)) << ") ns: " << count[b] << endl;
+        cout << "    p50 < " << percentile(0.5) << " ns, p99 < " << percentile(0.99) << " ns, p999 < "
+             << percentile(0.999) << " ns" << endl;
+    }
+};
+
+// ===== 并发链表 =====
+
+// 压力测试：各线程插入互不相交的一段键并删除其中奇数偏移者，另有读者线程持续查找与遍历
+// 结束后逐一核对规模与键和
+void stressConcurrentList(int threads, int perThread) {
+    ConcurrentList<int> list;
+    atomic<bool> done(false);
+    thread reader([&] {
+        unsigned seed = 7;
+        struct Sum { long long s; void operator()(int const& e) { s += e; } } sum;
+        while (!done.load()) {
+            sum.s = 0;
+            list.traverse(sum);
+            list.find((int)(nextRand(seed) % (threads * perThread)));
+        }
+    });
+    runThreads(threads, [&](int t) {
+        int base = t * perThread;
+        list.insertFirst(base);
+        for (int i = 1; i < perThread; i++) {
+            if (i % 2) check(list.insertAfter(base, base + i), "insertAfter找不到本线程的首键");
+            else list.insertFirst(base + i);
+        }
+        for (int i = 1; i < perThread; i += 2) check(list.remove(base + i), "remove找不到已插入的键");
+    });
+    done.store(true);
+    reader.join();
+
+    long long expect = 0;
+    for (int t = 0; t < threads; t++)
+        for (int i = 0; i < perThread; i += 2) expect += t * perThread + i;
+    struct Sum { long long s; void operator()(int const& e) { s += e; } } sum = {0};
+    list.traverse(sum);
+    check(list.size() == threads * (perThread - perThread / 2), "ConcurrentList规模不符");
+    check(sum.s == expect, "ConcurrentList键和不符");
+    cout << "ConcurrentList 压力测试通过（" << threads << " 线程，每线程 " << perThread << " 个键）" << endl;
+}
+
+// 吞吐量：预置keys个键，各线程执行ops次操作（90%查找，5%插入，5%删除）
+void benchConcurrentList(int keys, int ops) {
+    cout << "ConcurrentList 吞吐量（" << keys << " 个键，90%查找/5%插入/5%删除）:" << endl;
+    for (int k = 0; k < NTHREADS; k++) {
+        ConcurrentList<int> list;
+        for (int i = 0; i < keys; i++) list.insertFirst(i);
+        double ms = runThreads(THREADS[k], [&](int t) {
+            unsigned seed = 17 + t;
+            for (int i = 0; i < ops; i++) {
+                unsigned r = nextRand(seed);
+                int key = (int)((r >> 4) % keys);
+                if (r % 20 == 0) list.insertFirst(key);
+                else if (r % 20 == 1) list.remove(key);
+                else list.find(key);
+            }
+        });
+        cout << "  " << THREADS[k] << " 线程: " << ms << " ms, "
+             << (long long)(THREADS[k] * (double)ops / ms * 1000) << " 次操作/秒" << endl;
+    }
+}
+
+// ===== 无锁栈 =====
+
+// 压力测试：producers个线程各压入perThread个互异的值（部分经pushAll成批压入），
+// consumers个线程同时弹出（部分经popAll整体摘下）；结束后弹出的个数与值之和须与压入的完全一致
+void stressConcurrentStack(int producers, int consumers, int perThread) {
+    ConcurrentStack<long long> stack;
+    atomic<int> running(producers);
+    atomic<long long> count(0), sum(0);
+    runThreads(producers + consumers, [&](int t) {
+        if (t < producers) {
+            long long batch[8];
+            for (int i = 0; i < perThread; ) {
+                if (i % 64 == 0 && i + 8 <= perThread) { // 每64个值中有8个成批压入
+                    for (int j = 0; j < 8; j++) batch[j] = (long long)t * perThread + i + j + 1;
+                    stack.pushAll(batch, 8);
+                    i += 8;
+                } else {
+                    stack.push((long long)t * perThread + i + 1);
+                    i++;
+                }
+            }
+            running.fetch_sub(1);
+        } else {
+            struct Acc {
+                long long c, s;
+                void operator()(long long const& e) { c++; s += e; }
+            } acc = {0, 0};
+            long long e;
+            for (int i = 0; running.load() > 0 || !stack.empty(); i++) {
+                if (i % 256 == 0) stack.popAll(acc);
+                else if (stack.pop(e)) { acc.c++; acc.s += e; }
+            }
+            count.fetch_add(acc.c);
+            sum.fetch_add(acc.s);
+        }
+    });
+    long long n = (long long)producers * perThread;
+    check(count.load() == n, "ConcurrentStack弹出的个数不符");
+    check(sum.load() == n * (n + 1) / 2, "ConcurrentStack弹出的值之和不符");
+    check(stack.empty() && stack.size() == 0, "ConcurrentStack未被清空");
+    cout << "ConcurrentStack 压力测试通过（" << producers << " 生产者/" << consumers << " 消费者，共 "
+         << n << " 个元素）" << endl;
+}
+
+// 对照组：以一把互斥锁保护的顺序栈
+template <typename T> class LockedStack {
+private:
+    Stack<T> stack;
+    mutex lock;
+
+public:
+    void push(T const& e) {
+        lock_guard<mutex> g(lock);
+        stack.push(e);
+    }
+    bool pop(T& e) {
+        lock_guard<mutex> g(lock);
+        if (stack.empty()) return false;
+        e = stack.pop();
+        return true;
+    }
+};
+
+// 吞吐量：各线程交替执行ops对push/pop，无锁栈与加锁栈对照
+void benchConcurrentStack(int ops) {
+    cout << "ConcurrentStack vs 加锁Stack 吞吐量（每线程 " << ops << " 对push/pop）:" << endl;
+    for (int k = 0; k < NTHREADS; k++) {
+        ConcurrentStack<int> lockFree;
+        LockedStack<int> locked;
+        double lockFreeMs = runThreads(THREADS[k], [&](int t) {
+            int e;
+            for (int i = 0; i < ops; i++) {
+                lockFree.push(t + i);
+                lockFree.pop(e);
+            }
+        });
+        double lockedMs = runThreads(THREADS[k], [&](int t) {
+            int e;
+            for (int i = 0; i < ops; i++) {
+                locked.push(t + i);
+                locked.pop(e);
+            }
+        });
+        double total = 2 * THREADS[k] * (double)ops * 1000;
+        cout << "  " << THREADS[k] << " 线程: 无锁 " << lockFreeMs << " ms（" << (long long)(total / lockFreeMs)
+             << " 次操作/秒）, 加锁 " << lockedMs << " ms（" << (long long)(total / lockedMs) << " 次操作/秒）" << endl;
+    }
+}
+
+// ===== 单生产者/单消费者队列 =====
+
+// 顺序测试：生产者依次送出1..n（单个与成批入队交替），消费者（单个与成批出队交替）须按原序逐一收到
+void stressSpscQueue(int n, int capacity) {
+    SpscQueue<int> queue(capacity);
+    int received = 0;
+    bool inOrder = true;
+    thread consumer([&] {
+        int A[16];
+        while (received < n) {
+            int k = (received % 3 == 0) ? queue.pop(A, 16) : (queue.pop(A[0]) ? 1 : 0);
+            if (!k) { this_thread::yield(); continue; }
+            for (int i = 0; i < k; i++)
+                if (A[i] != ++received) inOrder = false;
+        }
+    });
+    int A[16];
+    for (int next = 1; next <= n; ) {
+        int k;
+        if (next % 5 == 0) { // 成批入队
+            int m = 0;
+            while (m < 16 && next + m <= n) { A[m] = next + m; m++; }
+            k = queue.push(A, m);
+        } else {
+            k = queue.push(next) ? 1 : 0;
+        }
+        if (!k) this_thread::yield();
+        next += k;
+    }
+    consumer.join();
+    check(inOrder, "SpscQueue出队次序与入队次序不一致");
+    check(queue.empty(), "SpscQueue未被清空");
+    cout << "SpscQueue 顺序测试通过（" << n << " 个元素，容量 " << capacity << "）" << endl;
+}
+
+// 吞吐量：逐个与成批（每批batch个）传送n个元素；延迟：经一对队列往返rounds次，逐次计时并统计分布
+void benchSpscQueue(int n, int batch, int rounds) {
+    cout << "SpscQueue 吞吐量（" << n << " 个元素）:" << endl;
+    int sizes[] = {1, batch};
+    for (int j = 0; j < 2; j++) {
+        int b = sizes[j];
+        SpscQueue<int> queue(1024);
+        double ms = runThreads(2, [&](int t) { // 0号线程生产，1号线程消费
+            int* buf = new int[b];
+            for (int i = 0; i < b; i++) buf[i] = i;
+            for (int done = 0; done < n; ) {
+                int m = (n - done < b) ? n - done : b;
+                int k = (t == 0) ? queue.push(buf, m) : queue.pop(buf, m);
+                if (!k) this_thread::yield();
+                done += k;
+            }
+            delete[] buf;
+        });
+        cout << "  每批 " << b << " 个: " << ms << " ms, " << (long long)(n / ms * 1000) << " 个/秒" << endl;
+    }
+
+    SpscQueue<int> ping(2), pong(2);
+    LatencyHistogram hist; // 仅由0号线程写入
+    double ms = runThreads(2, [&](int t) {
+        int e;
+        for (int i = 0; i < rounds; i++) {
+            if (t == 0) {
+                chrono::steady_clock::time_point start = chrono::steady_clock::now();
+                while (!ping.push(i)) this_thread::yield();
+                while (!pong.pop(e)) this_thread::yield();
+                hist.record(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count());
+            } else {
+                while (!ping.pop(e)) this_thread::yield();
+                while (!pong.push(e)) this_thread::yield();
+            }
+        }
+    });
+    cout << "SpscQueue 往返延迟（" << rounds << " 次）: 平均 " << ms * 1e6 / rounds << " ns, 分布:" << endl;
+    hist.print();
+}
+
+// ===== 多生产者/多消费者队列 =====
+
+// 压力测试：producers个线程各送出perThread个互异的正数（try与阻塞入队交替），最后完成者再送出consumers个0作为结束标记；
+// consumers个线程阻塞出队直至收到0；收到的个数与值之和须与送出的完全一致
+void stressMpmcQueue(int producers, int consumers, int perThread, int capacity) {
+    MpmcQueue<long long> queue(capacity);
+    atomic<int> running(producers);
+    atomic<long long> count(0), sum(0);
+    runThreads(producers + consumers, [&](int t) {
+        if (t < producers) {
+            for (int i = 0; i < perThread; i++) {
+                long long e = (long long)t * perThread + i + 1;
+                if (i % 2) queue.enqueue(e);
+                else while (!queue.tryEnqueue(e)) this_thread::yield();
+            }
+            if (running.fetch_sub(1) == 1)
+                for (int c = 0; c < consumers; c++) queue.enqueue(0);
+        } else {
+            long long c = 0, s = 0;
+            for (long long e; (e = queue.dequeue()) != 0; c++) s += e;
+            count.fetch_add(c);
+            sum.fetch_add(s);
+        }
+    });
+    long long n = (long long)producers * perThread;
+    check(count.load() == n, "MpmcQueue出队的个数不符");
+    check(sum.load() == n * (n + 1) / 2, "MpmcQueue出队的值之和不符");
+    check(queue.empty(), "MpmcQueue未被清空");
+    cout << "MpmcQueue 压力测试通过（" << producers << " 生产者/" << consumers << " 消费者，共 "
+         << n << " 个元素，容量 " << capacity << "）" << endl;
+}
+
+// 吞吐量：k个生产者与k个消费者共传送n个元素；延迟：两线程经一对队列阻塞往返rounds次的平均耗时
+void benchMpmcQueue(int n, int rounds) {
+    cout << "MpmcQueue 吞吐量（" << n << " 个元素）:" << endl;
+    for (int k = 0; k < NTHREADS && THREADS[k] <= 4; k++) {
+        int pairs = THREADS[k];
+        MpmcQueue<int> queue(1024);
+        double ms = runThreads(2 * pairs, [&](int t) {
+            int share = n / pairs + (t % pairs < n % pairs ? 1 : 0); // 各生产者（消费者）分摊的个数
+            for (int i = 0; i < share; i++) {
+                if (t < pairs) queue.enqueue(i);
+                else queue.dequeue();
+            }
+        });
+        cout << "  " << pairs << " 生产者/" << pairs << " 消费者: " << ms << " ms, "
+             << (long long)(n / ms * 1000) << " 个/秒" << endl;
+    }
+
+    MpmcQueue<int> ping(2), pong(2);
+    double ms = runThreads(2, [&](int t) {
+        for (int i = 0; i < rounds; i++) {
+            if (t == 0) {
+                ping.enqueue(i);
+                pong.dequeue();
+            } else {
+                pong.enqueue(ping.dequeue());
+            }
+        }
+    });
+    cout << "MpmcQueue 往返延迟（" << rounds << " 次）: 平均 " << ms * 1e6 / rounds << " ns" << endl;
+}
+
+// ===== 工作窃取线程池 =====
+
+long long fib(int n) { return n < 2 ? n : fib(n - 1) + fib(n - 2); }
+
+// 并行fib：n不小于cutoff时两个子问题以join并行求解，否则串行
+long long parallelFib(ForkJoinPool& pool, int n, int cutoff) {
+    if (n < cutoff) return fib(n);
+    long long a = 0, b = 0;
+    pool.join([&] { a = parallelFib(pool, n - 1, cutoff); }, [&] { b = parallelFib(pool, n - 2, cutoff); });
+    return a + b;
+}
+
+// 正确性：并行fib与串行结果一致；以spawn/wait分块求和，各块恰好执行一次
+void stressForkJoinPool(int n, int blocks) {
+    ForkJoinPool pool(4);
+    long long expect = fib(n);
+    for (int cutoff = 2; cutoff <= n; cutoff += 6) {
+        long long r = 0;
+        pool.invoke([&] { r = parallelFib(pool, n, cutoff); });
+        check(r == expect, "并行fib结果不符");
+    }
+    atomic<int>* hits = new atomic<int>[blocks];
+    for (int i = 0; i < blocks; i++) hits[i].store(0);
+    atomic<long long> sum(0);
+    pool.invoke([&] {
+        TaskGroup g;
+        for (int i = 0; i < blocks; i++)
+            pool.spawn(g, [&, i] { hits[i].fetch_add(1); sum.fetch_add(i); });
+        pool.wait(g);
+    });
+    for (int i = 0; i < blocks; i++) check(hits[i].load() == 1, "spawn派生的任务未恰好执行一次");
+    check(sum.load() == (long long)blocks * (blocks - 1) / 2, "spawn派生任务的和不符");
+    delete[] hits;
+
+    // 异常：子任务抛出的异常由wait重新抛出，且其余任务照常完成；join两侧及invoke本身抛出亦然
+    atomic<int> finished(0);
+    bool caught = false;
+    try {
+        pool.invoke([&] {
+            TaskGroup g;
+            for (int i = 0; i < blocks; i++)
+                pool.spawn(g, [&, i] {
+                    if (i % 1000 == 7) throw runtime_error("task");
+                    finished.fetch_add(1);
+                });
+            pool.wait(g);
+        });
+    } catch (runtime_error const&) {
+        caught = true;
+    }
+    check(caught, "子任务的异常未由wait抛出");
+    check(finished.load() == blocks - (blocks + 992) / 1000, "抛出异常后其余子任务未全部完成");
+    for (int side = 0; side < 2; side++) {
+        caught = false;
+        try {
+            pool.invoke([&] {
+                pool.join([&] { if (side == 0) throw runtime_error("a"); },
+                          [&] { if (side == 1) throw runtime_error("b"); });
+            });
+        } catch (runtime_error const&) {
+            caught = true;
+        }
+        check(caught, "join未传出异常");
+    }
+    long long r = 0;
+    pool.invoke([&] { r = parallelFib(pool, n, 12); }); // 异常之后调度器仍可用
+    check(r == expect, "异常之后并行fib结果不符");
+    cout << "ForkJoinPool 正确性测试通过（fib(" << n << ")，" << blocks << " 个派生任务，含异常传递）" << endl;
+}
+
+// 扩展性：不同工作线程数下并行fib(n)的耗时，以串行耗时为基准
+void benchForkJoinPool(int n, int cutoff) {
+    long long expect = 0;
+    double serialMs = runThreads(1, [&](int) { expect = fib(n); });
+    cout << "ForkJoinPool 扩展性（fib(" << n << ")，cutoff " << cutoff << "，串行 " << serialMs << " ms）:" << endl;
+    for (int k = 0; k < NTHREADS; k++) {
+        ForkJoinPool pool(THREADS[k]);
+        long long r = 0;
+        double ms = runThreads(1, [&](int) { pool.invoke([&] { r = parallelFib(pool, n, cutoff); }); });
+        check(r == expect, "并行fib结果不符");
+        cout << "  " << THREADS[k] << " 线程: " << ms << " ms, 加速比 " << serialMs / ms << endl;
+    }
+}
+
+// 数据并行（非递归）：y = a*x + y后求y的平方和，数组按block个一块平铺派生，各块部分和最后汇总
+double saxpyNorm(ForkJoinPool* pool, double a, double const* x, double* y, int n, int block) {
+    int blocks = (n + block - 1) / block;
+    double* partial = new double[blocks];
+    auto body = [=](int b) {
+        int lo = b * block, hi = (lo + block < n) ? lo + block : n;
+        double s = 0;
+        for (int i = lo; i < hi; i++) {
+            y[i] += a * x[i];
+            s += y[i] * y[i];
+        }
+        partial[b] = s;
+    };
+    if (!pool) {
+        for (int b = 0; b < blocks; b++) body(b);
+    } else {
+        pool->invoke([&] {
+            TaskGroup g;
+            for (int b = 0; b < blocks; b++) pool->spawn(g, [=] { body(b); });
+            pool->wait(g);
+        });
+    }
+    double sum = 0;
+    for (int b = 0; b < blocks; b++) sum += partial[b]; // 按块序汇总，结果与线程数无关
+    delete[] partial;
+    return sum;
+}
+
+void benchDataParallel(int n, int block, int rounds) {
+    double* x = new double[n];
+    double* y = new double[n];
+    for (int i = 0; i < n; i++) x[i] = (i % 100) * 0.01;
+    for (int i = 0; i < n; i++) y[i] = 1;
+    double expect = 0;
+    double serialMs = runThreads(1, [&](int) {
+        for (int r = 0; r < rounds; r++) expect = saxpyNorm(nullptr, 0.5, x, y, n, block);
+    });
+    cout << "ForkJoinPool 数据并行（" << n << " 个元素的saxpy+平方和，每块 " << block << " 个，" << rounds
+         << " 轮，串行 " << serialMs << " ms）:" << endl;
+    for (int k = 0; k < NTHREADS; k++) {
+        ForkJoinPool pool(THREADS[k]);
+        for (int i = 0; i < n; i++) y[i] = 1;
+        double r = 0;
+        double ms = runThreads(1, [&](int) {
+            for (int j = 0; j < rounds; j++) r = saxpyNorm(&pool, 0.5, x, y, n, block);
+        });
+        check(r == expect, "数据并行结果不符");
+        cout << "  " << THREADS[k] << " 线程: " << ms << " ms, 加速比 " << serialMs / ms << endl;
+    }
+    delete[] x;
+    delete[] y;
+}
+
+int main() {
+    cout << "=== 并发链表 ===" << endl;
+    stressConcurrentList(4, 400);
+    benchConcurrentList(1000, 2000);
+
+    cout << "\n=== 无锁栈 ===" << endl;
+    stressConcurrentStack(4, 4, 50000);
+    benchConcurrentStack(200000);
+
+    cout << "\n=== 单生产者/单消费者队列 ===" << endl;
+    stressSpscQueue(1000000, 64);
+    benchSpscQueue(2000000, 32, 20000);
+
+    cout << "\n=== 多生产者/多消费者队列 ===" << endl;
+    stressMpmcQueue(4, 4, 50000, 64);
+    benchMpmcQueue(1000000, 20000);
+
+    cout << "\n=== 工作窃取线程池 ===" << endl;
+    stressForkJoinPool(24, 10000);
+    benchForkJoinPool(35, 20);
+    benchDataParallel(1 << 22, 1 << 14, 20);
+
+    return 0;
+}
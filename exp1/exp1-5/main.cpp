@@ -0,0 +1,153 @@
+// 顺序容器性能对比：同一工作负载下比较不同实现的耗时，并核对结果一致
+// 编译：g++ -std=c++11 -O2 main.cpp
+#include <iostream>
+#include <cstdlib>
+#include <chrono>
+#include "../Stack.h"
+#include "../PriorityQueue.h"
+
+using namespace std;
+
+// 校验失败即报错退出
+void check(bool ok, char const* what) {
+    if (!ok) {
+        cerr << "校验失败：" << what << endl;
+        exit(EXIT_FAILURE);
+    }
+}
+
+// 计时：返回f执行的毫秒数
+template <typename F> double timeMs(F f) {
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+// ===== 栈：链式实现 vs 顺序（数组）实现 =====
+
+// 链式栈（即Stack.h改为顺序栈之前的实现）：每次入栈分配一个节点
+template <typename T> class LinkedStack {
+private:
+    struct Node {
+        T data;
+        Node* next;
+
+        Node(T const& e, Node* n = nullptr) : data(e), next(n) {}
+    };
+
+    Node* top;
+    int _size;
+
+public:
+    LinkedStack() : top(nullptr), _size(0) {}
+    ~LinkedStack() {
+        while (!empty()) pop();
+    }
+
+    int size() const { return _size; }
+    bool empty() const { return _size == 0; }
+    void push(T const& e) {
+        top = new Node(e, top);
+        _size++;
+    }
+    T pop() {
+        Node* oldTop = top;
+        T e = oldTop->data;
+        top = top->next;
+        delete oldTop;
+        _size--;
+        return e;
+    }
+    T& peek() const { return top->data; }
+};
+
+// 柱状图中的最大矩形面积（同exp1-3的单调栈算法），栈的实现由模板参数S指定
+template <typename S> long long largestRectangleArea(int const* heights, int n) {
+    S stack;
+    long long maxArea = 0;
+    for (int i = 0; i <= n; ++i) {
+        int h = (i < n) ? heights[i] : -1; // 末尾以高度-1的哨兵清空栈
+        while (!stack.empty() && h < heights[stack.peek()]) {
+            long long height = heights[stack.pop()];
+            long long width = stack.empty() ? i : i - stack.peek() - 1;
+            if (height * width > maxArea) maxArea = height * width;
+        }
+        stack.push(i);
+    }
+    return maxArea;
+}
+
+// 在exp1-3的负载（10万根柱子）上比较两种栈：随机高度（栈较浅）与递增高度（栈深达n）各测rounds轮
+void benchStack(int n, int rounds) {
+    int* random = new int[n];
+    int* ascending = new int[n];
+    srand(1);
+    for (int i = 0; i < n; i++) {
+        random[i] = rand() % 10001;
+        ascending[i] = i;
+    }
+    char const* names[] = {"随机高度", "递增高度"};
+    int* inputs[] = {random, ascending};
+    cout << "栈：链式 vs 顺序（" << n << " 根柱子，各 " << rounds << " 轮）:" << endl;
+    for (int k = 0; k < 2; k++) {
+        long long a = 0, b = 0;
+        double linkedMs = timeMs([&] {
+            for (int r = 0; r < rounds; r++) a += largestRectangleArea<LinkedStack<int> >(inputs[k], n);
+        });
+        double arrayMs = timeMs([&] {
+            for (int r = 0; r < rounds; r++) b += largestRectangleArea<Stack<int> >(inputs[k], n);
+        });
+        check(a == b, "两种栈的计算结果不一致");
+        cout << "  " << names[k] << ": 链式 " << linkedMs << " ms, 顺序 " << arrayMs << " ms, 加速比 "
+             << linkedMs / arrayMs << endl;
+    }
+    delete[] random;
+    delete[] ascending;
+}
+
+// ===== 优先级队列：二叉堆 vs 四叉堆（另附八叉堆） =====
+
+// 依次压入n个随机数再全部弹出（须为非增序），然后以m次“弹出堆顶、压入新值”模拟事件队列，返回校验和
+template <int D> long long heapWorkload(int const* A, int n, int m) {
+    PriorityQueue<int, D> pq;
+    for (int i = 0; i < n; i++) pq.push(A[i]);
+    long long sum = 0;
+    int last = pq.top();
+    while (!pq.empty()) {
+        int e = pq.pop();
+        check(e <= last, "优先级队列出队次序错误");
+        last = e;
+        sum += e;
+    }
+    for (int i = 0; i < n; i++) pq.push(A[i]);
+    for (int i = 0; i < m; i++) {
+        int e = pq.pop();
+        sum += e;
+        pq.push(e - A[i % n] % 1000 - 1); // 新值小于刚弹出者，犹如事件时间推后（大顶堆中优先级降低）
+    }
+    return sum;
+}
+
+void benchHeap(int n, int m) {
+    int* A = new int[n];
+    srand(2);
+    for (int i = 0; i < n; i++) A[i] = rand();
+    cout << "优先级队列（" << n << " 次压入/弹出，另 " << m << " 次弹出并压入）:" << endl;
+    long long r2 = 0, r4 = 0, r8 = 0;
+    double ms2 = timeMs([&] { r2 = heapWorkload<2>(A, n, m); });
+    double ms4 = timeMs([&] { r4 = heapWorkload<4>(A, n, m); });
+    double ms8 = timeMs([&] { r8 = heapWorkload<8>(A, n, m); });
+    check(r2 == r4 && r4 == r8, "各叉数的堆结果不一致");
+    cout << "  二叉堆 " << ms2 << " ms, 四叉堆 " << ms4 << " ms, 八叉堆 " << ms8 << " ms" << endl;
+    delete[] A;
+}
+
+int main() {
+    cout << "=== 栈 ===" << endl;
+    benchStack(100000, 20);
+
+    cout << "\n=== 优先级队列 ===" << endl;
+    benchHeap(1000000, 1000000);
+
+    return 0;
+}
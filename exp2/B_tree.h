@@ -0,0 +1,303 @@
+#ifndef B_TREE_H
+#define B_TREE_H
+#include <iostream>
+#include <cstdlib>
+#include <type_traits>
+#include <iterator>
+#include <cstddef>
+#include "../exp1/Vector.h"
+using namespace std;
+
+// B+树（有序映射K -> V）：每个节点约占NODE_BYTES字节（默认256字节即4个缓存行，亦可取4096即一页），
+// 一次查找只需访问log_B(n)个节点，较二叉树每层一次缓存缺失少得多
+// 内部节点只存分隔键与孩子指针；全部键值对存于叶子，叶子自左向右串成链表，供区间迭代
+// 节点内查找：算术类型的键以无分支计数（统计小于k的键数）扫描整个有序键数组，编译器可将其向量化为SIMD比较；
+// 其他类型的键用二分查找
+// 键互异，插入已有的键即覆盖其值；仅支持插入、查找与迭代（不支持删除）
+template <typename K, typename V, int NODE_BYTES = 256> class BTree {
+private:
+    static const int LEAF_CAP = (NODE_BYTES - 16) / (int)(sizeof(K) + sizeof(V)) < 4
+                                ? 4 : (NODE_BYTES - 16) / (int)(sizeof(K) + sizeof(V));      // 叶子容量
+    static const int INNER_CAP = (NODE_BYTES - 16) / (int)(sizeof(K) + sizeof(void*)) < 4
+                                 ? 4 : (NODE_BYTES - 16) / (int)(sizeof(K) + sizeof(void*)); // 内部节点的键容量
+
+    struct Node {
+        int n;        // 键数
+        bool leaf;
+        Node(bool isLeaf) : n(0), leaf(isLeaf) {}
+    };
+    struct Leaf : Node {
+        K keys[LEAF_CAP];
+        V values[LEAF_CAP];
+        Leaf* next;   // 右邻叶子
+        Leaf() : Node(true), next(NULL) {}
+    };
+    struct Inner : Node {
+        K keys[INNER_CAP];            // keys[i]为child[i + 1]中的最小键
+        Node* child[INNER_CAP + 1];
+        Inner() : Node(false) {}
+    };
+
+    Node* root;
+    Leaf* head;   // 最左叶子
+    int _size;
+    int _height;  // 层数（空树为0）
+
+    // 有序键数组中小于k（strict为false时为不大于k）的键数
+    static int countBelow(K const* keys, int n, K const& k, bool strict, true_type) { // 算术类型：无分支计数
+        int c = 0;
+        if (strict) for (int i = 0; i < n; i++) c += (keys[i] < k);
+        else for (int i = 0; i < n; i++) c += !(k < keys[i]);
+        return c;
+    }
+    static int countBelow(K const* keys, int n, K const& k, bool strict, false_type) { // 其他类型：二分查找
+        int lo = 0, hi = n;
+        while (lo < hi) {
+            int mi = (lo + hi) >> 1;
+            if (strict ? (keys[mi] < k) : !(k < keys[mi])) lo = mi + 1;
+            else hi = mi;
+        }
+        return lo;
+    }
+    static int lowerIndex(K const* keys, int n, K const& k) {
+        return countBelow(keys, n, k, true, typename is_arithmetic<K>::type());
+    }
+    static int upperIndex(K const* keys, int n, K const& k) {
+        return countBelow(keys, n, k, false, typename is_arithmetic<K>::type());
+    }
+
+    // 自根下行至k所在的叶子
+    Leaf* findLeaf(K const& k) const {
+        Node* x = root;
+        if (!x) return NULL;
+        while (!x->leaf) {
+            Inner* in = static_cast<Inner*>(x);
+            x = in->child[upperIndex(in->keys, in->n, k)];
+        }
+        return static_cast<Leaf*>(x);
+    }
+
+    // 在以x为根的子树中插入；x分裂时返回true，并经sep、right带回分隔键与新的右兄弟
+    bool insert(Node* x, K const& k, V const& v, bool& inserted, K& sep, Node*& right) {
+        if (x->leaf) {
+            Leaf* leaf = static_cast<Leaf*>(x);
+            int i = lowerIndex(leaf->keys, leaf->n, k);
+            if (i < leaf->n && !(k < leaf->keys[i])) { leaf->values[i] = v; inserted = false; return false; }
+            inserted = true;
+            if (leaf->n < LEAF_CAP) { insertAt(leaf, i, k, v); return false; }
+            Leaf* r = new Leaf; // 满则对半分裂，再插入相应的一半
+            int half = LEAF_CAP / 2;
+            for (int j = half; j < LEAF_CAP; j++) { r->keys[j - half] = leaf->keys[j]; r->values[j - half] = leaf->values[j]; }
+            r->n = LEAF_CAP - half;
+            leaf->n = half;
+            r->next = leaf->next;
+            leaf->next = r;
+            if (i <= half) insertAt(leaf, i, k, v);
+            else insertAt(r, i - half, k, v);
+            sep = r->keys[0];
+            right = r;
+            return true;
+        }
+        Inner* in = static_cast<Inner*>(x);
+        int i = upperIndex(in->keys, in->n, k);
+        K childSep;
+        Node* childRight;
+        if (!insert(in->child[i], k, v, inserted, childSep, childRight)) return false;
+        if (in->n < INNER_CAP) { insertAt(in, i, childSep, childRight); return false; }
+        Inner* r = new Inner; // 满则分裂：中间的键上升至父亲
+        int mid = INNER_CAP / 2;
+        sep = in->keys[mid];
+        for (int j = mid + 1; j < INNER_CAP; j++) r->keys[j - mid - 1] = in->keys[j];
+        for (int j = mid + 1; j <= INNER_CAP; j++) r->child[j - mid - 1] = in->child[j];
+        r->n = INNER_CAP - mid - 1;
+        in->n = mid;
+        if (i <= mid) insertAt(in, i, childSep, childRight);
+        else insertAt(r, i - mid - 1, childSep, childRight);
+        right = r;
+        return true;
+    }
+
+    static void insertAt(Leaf* leaf, int i, K const& k, V const& v) {
+        for (int j = leaf->n; j > i; j--) { leaf->keys[j] = leaf->keys[j - 1]; leaf->values[j] = leaf->values[j - 1]; }
+        leaf->keys[i] = k;
+        leaf->values[i] = v;
+        leaf->n++;
+    }
+    static void insertAt(Inner* in, int i, K const& k, Node* right) { // 键插入i处，right成为child[i + 1]
+        for (int j = in->n; j > i; j--) { in->keys[j] = in->keys[j - 1]; in->child[j + 1] = in->child[j]; }
+        in->keys[i] = k;
+        in->child[i + 1] = right;
+        in->n++;
+    }
+
+    static void destroy(Node* x) {
+        if (!x) return;
+        if (x->leaf) { delete static_cast<Leaf*>(x); return; }
+        Inner* in = static_cast<Inner*>(x);
+        for (int i = 0; i <= in->n; i++) destroy(in->child[i]);
+        delete in;
+    }
+
+    BTree(BTree const&);            // 禁止复制
+    BTree& operator=(BTree const&);
+
+public:
+    // 区间迭代器：沿叶子链表前进；key()为键（只读），value()与解引用均得值
+    // Iterator可修改值，ConstIterator（由const的树得到）只读；Iterator可隐式转为ConstIterator
+    template <bool CONST> class BasicIterator {
+        friend class BTree;
+        template <bool> friend class BasicIterator;
+    private:
+        Leaf* leaf;
+        int i;
+        BasicIterator(Leaf* l, int k) : leaf(l), i(k) {
+            if (leaf && i >= leaf->n) { leaf = leaf->next; i = 0; }
+        }
+    public:
+        typedef forward_iterator_tag iterator_category;
+        typedef V value_type;
+        typedef ptrdiff_t difference_type;
+        typedef typename conditional<CONST, V const*, V*>::type pointer;
+        typedef typename conditional<CONST, V const&, V&>::type reference;
+
+        BasicIterator() : leaf(NULL), i(0) {}
+        BasicIterator(BasicIterator<false> const& it) : leaf(it.leaf), i(it.i) {}
+        K const& key() const { return leaf->keys[i]; }
+        reference value() const { return leaf->values[i]; }
+        reference operator*() const { return leaf->values[i]; }
+        pointer operator->() const { return &leaf->values[i]; }
+        BasicIterator& operator++() {
+            if (++i >= leaf->n) { leaf = leaf->next; i = 0; }
+            return *this;
+        }
+        BasicIterator operator++(int) { BasicIterator old = *this; ++*this; return old; }
+        bool operator==(BasicIterator const& it) const { return leaf == it.leaf && i == it.i; }
+        bool operator!=(BasicIterator const& it) const { return !(*this == it); }
+    };
+    typedef BasicIterator<false> Iterator;
+    typedef BasicIterator<true> ConstIterator;
+
+    // 构造/析构
+    BTree() : root(NULL), head(NULL), _size(0), _height(0) {}
+    ~BTree() { clear(); }
+
+    // 基础操作
+    int size() const { return _size; }
+    bool empty() const { return _size == 0; }
+    int height() const { return _height; }
+    void clear() {
+        destroy(root);
+        root = NULL;
+        head = NULL;
+        _size = 0;
+        _height = 0;
+    }
+
+    // 插入：k已存在则覆盖其值并返回false
+    bool insert(K const& k, V const& v) {
+        if (!root) {
+            Leaf* leaf = new Leaf;
+            root = head = leaf;
+            _height = 1;
+        }
+        bool inserted = false;
+        K sep;
+        Node* right;
+        if (insert(root, k, v, inserted, sep, right)) { // 根分裂：树长高一层
+            Inner* r = new Inner;
+            r->keys[0] = sep;
+            r->child[0] = root;
+            r->child[1] = right;
+            r->n = 1;
+            root = r;
+            _height++;
+        }
+        if (inserted) _size++;
+        return inserted;
+    }
+
+    // 查找：返回k对应的值，不存在则返回NULL
+    V* find(K const& k) {
+        Leaf* leaf = findLeaf(k);
+        if (!leaf) return NULL;
+        int i = lowerIndex(leaf->keys, leaf->n, k);
+        return (i < leaf->n && !(k < leaf->keys[i])) ? &leaf->values[i] : NULL;
+    }
+    V const* find(K const& k) const { return const_cast<BTree*>(this)->find(k); }
+    bool contains(K const& k) const { return find(k) != NULL; }
+
+    // 迭代
+    Iterator begin() { return Iterator(head, 0); }
+    Iterator end() { return Iterator(); }
+    Iterator lowerBound(K const& k) { // 首个不小于k的键
+        Leaf* leaf = findLeaf(k);
+        return leaf ? Iterator(leaf, lowerIndex(leaf->keys, leaf->n, k)) : end();
+    }
+    ConstIterator begin() const { return const_cast<BTree*>(this)->begin(); }
+    ConstIterator end() const { return ConstIterator(); }
+    ConstIterator lowerBound(K const& k) const { return const_cast<BTree*>(this)->lowerBound(k); }
+
+    // 区间遍历：依次以visit(key, value)访问[lo, hi)中的键值对（值只读），返回访问的个数
+    template <typename VST> int range(K const& lo, K const& hi, VST visit) const {
+        int c = 0;
+        for (ConstIterator it = lowerBound(lo); it != end() && it.key() < hi; ++it, c++) visit(it.key(), it.value());
+        return c;
+    }
+
+    // 批量构建：以有序（严格递增）的keys及对应的values替换当前内容，O(n)
+    // 叶子填满（各层节点数取最少，键数均匀分配），逐层向上建立内部节点；keys无序则报错并返回false
+    bool bulkLoad(Vector<K> const& keys, Vector<V> const& values) {
+        int n = keys.size();
+        if (values.size() != n) {
+            cerr << "键与值的数目不等，无法批量构建！" << endl;
+            return false;
+        }
+        for (int i = 1; i < n; i++)
+            if (!(keys[i - 1] < keys[i])) {
+                cerr << "键须严格递增，无法批量构建！" << endl;
+                return false;
+            }
+        clear();
+        if (n == 0) return true;
+        int m = (n + LEAF_CAP - 1) / LEAF_CAP; // 叶子数
+        Node** level = new Node*[m];
+        K* minKey = new K[m];                  // 各节点子树中的最小键
+        Leaf* prev = NULL;
+        for (int j = 0, pos = 0; j < m; j++) {
+            Leaf* leaf = new Leaf;
+            int cnt = n / m + (j < n % m ? 1 : 0);
+            for (int t = 0; t < cnt; t++, pos++) { leaf->keys[t] = keys[pos]; leaf->values[t] = values[pos]; }
+            leaf->n = cnt;
+            if (prev) prev->next = leaf; else head = leaf;
+            prev = leaf;
+            level[j] = leaf;
+            minKey[j] = leaf->keys[0];
+        }
+        _height = 1;
+        while (m > 1) { // 每个内部节点至多容纳INNER_CAP + 1个孩子
+            int p = (m + INNER_CAP) / (INNER_CAP + 1);
+            for (int j = 0, pos = 0; j < p; j++) {
+                Inner* in = new Inner;
+                int cnt = m / p + (j < m % p ? 1 : 0);
+                for (int t = 0; t < cnt; t++) {
+                    in->child[t] = level[pos + t];
+                    if (t) in->keys[t - 1] = minKey[pos + t];
+                }
+                in->n = cnt - 1;
+                K first = minKey[pos];
+                level[j] = in;
+                minKey[j] = first; // j <= pos，原地改写不会覆盖尚未读取的项
+                pos += cnt;
+            }
+            m = p;
+            _height++;
+        }
+        root = level[0];
+        _size = n;
+        delete[] level;
+        delete[] minKey;
+        return true;
+    }
+};
+
+#endif  // B_TREE_H
@@ -4,23 +4,40 @@
 #include <cstdlib>
 #include <algorithm>
 #include <functional>
+#include <iterator>
+#include <cstddef>
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+#include <new>
+#include <utility>
+#include "../exp1/Stack.h"
+#include "../exp1/ForkJoinPool.h" // 并行操作复用exp1的线程池（exp1须与exp2同处一个父目录），须以-pthread编译链接
 using namespace std;
 
+// std::hash<T>是否可用：不可用时（如pair）节点哈希不计入数据，只反映树形，BinaryTree<T>本身不因此受限
+template <typename T, typename = void> struct IsStdHashable : false_type {};
+template <typename T> struct IsStdHashable<T, decltype((void)std::hash<T>()(declval<T const&>()))> : true_type {};
+
 template <typename T> class BinaryTree {
 private:
     struct Node {
         T data;
         int height;
+        int size;     // 子树规模（按秩查询、addLeft/addRight替换子树时维护_size均依赖之，故始终维护）
+        size_t hash;  // 子树的结构哈希（由data及左右子树的哈希合成）
         Node* left;
         Node* right;
         Node* parent;
 
         Node(T const& e, Node* l = NULL, Node* r = NULL, Node* p = NULL) 
-            : data(e), left(l), right(r), parent(p), height(1) {}
+            : data(e), height(1), size(1), hash(combineHash(e, 0, 0)), left(l), right(r), parent(p) {}
     };
 
     Node* root;
     int _size;
+    Node* _block;     // 批量构建时一次分配的节点块（其余节点仍逐个new）
+    int _blockSize;
 
     // 辅助：更新节点高度
     void updateHeight(Node* node) {
@@ -30,25 +47,250 @@ private:
         node->height = max(leftH, rightH) + 1;
     }
 
-    // 辅助：递归销毁树
+    // 辅助：更新子树规模
+    void updateSize(Node* node) {
+        if (!node) return;
+        node->size = getSize(node->left) + getSize(node->right) + 1;
+    }
+
+    // 辅助：结构哈希（Merkle式）：h(x) = H(hash(data), h(left), h(right))，空子树取0
+    // 依次混合、且左右各自参与一轮混合，故交换左右子树一般会改变哈希；结构相同的树哈希必相同
+    static size_t mixHash(unsigned long long x) { // splitmix64的收尾混合
+        x ^= x >> 30; x *= 0xbf58476d1ce4e5b9ULL;
+        x ^= x >> 27; x *= 0x94d049bb133111ebULL;
+        x ^= x >> 31;
+        return (size_t)x;
+    }
+    static size_t dataHash(T const& e, true_type) { return std::hash<T>()(e); }
+    static size_t dataHash(T const&, false_type) { return 0; }
+    static size_t combineHash(T const& e, size_t leftHash, size_t rightHash) {
+        unsigned long long h = mixHash(dataHash(e, IsStdHashable<T>()) + 0x9e3779b97f4a7c15ULL);
+        h = mixHash(h ^ (leftHash + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2)));
+        h = mixHash(h ^ (rightHash + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2)));
+        return (size_t)h;
+    }
+    void updateHash(Node* node) {
+        if (!node) return;
+        node->hash = combineHash(node->data, node->left ? node->left->hash : 0, node->right ? node->right->hash : 0);
+    }
+
+    // ===== 有序集合模式（AVL）辅助 =====
+    int balanceFactor(Node* node) const { return getHeight(node->left) - getHeight(node->right); }
+
+    // 以newChild替换p的孩子oldChild（p为空则替换根）
+    void replaceChild(Node* p, Node* oldChild, Node* newChild) {
+        if (!p) root = newChild;
+        else if (p->left == oldChild) p->left = newChild;
+        else p->right = newChild;
+        if (newChild) newChild->parent = p;
+    }
+
+    // 单旋：以x的左（右）孩子y取代x，x降为y的右（左）孩子，返回y
+    Node* rotateRight(Node* x) {
+        Node* y = x->left;
+        replaceChild(x->parent, x, y);
+        x->left = y->right;
+        if (x->left) x->left->parent = x;
+        y->right = x;
+        x->parent = y;
+        updateHeight(x);
+        updateHeight(y);
+        updateSize(x);
+        updateSize(y);
+        updateHash(x);
+        updateHash(y);
+        return y;
+    }
+    Node* rotateLeft(Node* x) {
+        Node* y = x->right;
+        replaceChild(x->parent, x, y);
+        x->right = y->left;
+        if (x->right) x->right->parent = x;
+        y->left = x;
+        x->parent = y;
+        updateHeight(x);
+        updateHeight(y);
+        updateSize(x);
+        updateSize(y);
+        updateHash(x);
+        updateHash(y);
+        return y;
+    }
+
+    // 自x起向上更新高度，逐层按需单旋或双旋；某子树高度不变后，其祖先均无需再调整，只需更新规模与哈希
+    void rebalance(Node* x) {
+        while (x) {
+            int oldH = x->height;
+            updateHeight(x);
+            updateSize(x);
+            int bf = balanceFactor(x);
+            if (bf > 1) { // 左高
+                if (balanceFactor(x->left) < 0) rotateLeft(x->left); // LR型：先左旋左孩子
+                x = rotateRight(x);
+            } else if (bf < -1) { // 右高
+                if (balanceFactor(x->right) > 0) rotateRight(x->right); // RL型：先右旋右孩子
+                x = rotateLeft(x);
+            }
+            updateHash(x);
+            bool stable = (x->height == oldH);
+            x = x->parent;
+            if (stable) break;
+        }
+        for (; x; x = x->parent) { updateSize(x); updateHash(x); }
+    }
+
+    static Node* leftmost(Node* x) {
+        while (x && x->left) x = x->left;
+        return x;
+    }
+
+    // 中序后继（借助parent指针）
+    static Node* succ(Node* x) {
+        if (x->right) return leftmost(x->right);
+        Node* child = x;
+        for (x = x->parent; x && x->right == child; child = x, x = x->parent);
+        return x;
+    }
+
+    // 辅助：释放单个节点（节点块中者只析构，块本身待清空时整体释放）
+    void release(Node* node) {
+        if (_block && !less<Node*>()(node, _block) && less<Node*>()(node, _block + _blockSize)) node->~Node();
+        else delete node;
+    }
+    void releaseBlock() {
+        ::operator delete(_block);
+        _block = NULL;
+        _blockSize = 0;
+    }
+
+    // 辅助：销毁以node为根的子树（显式栈代替递归，链状深树亦不致栈溢出）
     void destroy(Node* node) {
-        if (node) {
-            destroy(node->left);
-            destroy(node->right);
-            delete node;
+        Stack<Node*> stack;
+        if (node) stack.push(node);
+        while (!stack.empty()) {
+            Node* x = stack.pop();
+            if (x->left) stack.push(x->left);
+            if (x->right) stack.push(x->right);
+            release(x);
         }
     }
 
-    // 辅助：递归拷贝树
-    Node* copy(Node* node, Node* parent) {
-        if (!node) return NULL;
+    // ===== 批量构建辅助 =====
+    // 清空当前树，并一次分配容纳n个节点的节点块
+    void allocBlock(int n) {
+        clear();
+        _block = static_cast<Node*>(::operator new(n * sizeof(Node)));
+        _blockSize = n;
+    }
+    Node* place(int i, T const& e, Node* parent) { return new (_block + i) Node(e, NULL, NULL, parent); }
+
+    // 节点块中各节点均排在其全部后代之前（先序或层序），故逆序一趟即相当于后序遍历，同时求得高度与哈希
+    void finishBlock(int n) {
+        for (int i = n - 1; 0 <= i; i--) {
+            updateHeight(_block + i);
+            updateSize(_block + i);
+            updateHash(_block + i);
+        }
+        root = n ? _block : NULL;
+        _size = n;
+    }
+
+    // 有序数组[lo, hi)按中点递归建成平衡树，节点按先序依次放入节点块，返回子树根
+    Node* buildBalanced(T const* a, int lo, int hi, Node* parent, int& k) {
+        if (hi <= lo) return NULL;
+        int mi = (lo + hi) >> 1;
+        Node* x = place(k++, a[mi], parent);
+        x->left = buildBalanced(a, lo, mi, x, k);
+        x->right = buildBalanced(a, mi + 1, hi, x, k);
+        return x;
+    }
+
+    // 辅助：复制单个节点（不含子树），高度、规模与哈希照搬原节点
+    static Node* cloneNode(Node* node, Node* parent) {
         Node* newNode = new Node(node->data, NULL, NULL, parent);
         newNode->height = node->height;
-        newNode->left = copy(node->left, newNode);
-        newNode->right = copy(node->right, newNode);
+        newNode->size = node->size;
+        newNode->hash = node->hash;
         return newNode;
     }
 
+    // 辅助：拷贝以node为根的子树（显式栈存放（原节点, 副本）对，先序逐个补上副本的孩子）
+    Node* copy(Node* node, Node* parent) {
+        if (!node) return NULL;
+        Node* newRoot = cloneNode(node, parent);
+        Stack<pair<Node*, Node*> > stack;
+        stack.push(make_pair(node, newRoot));
+        while (!stack.empty()) {
+            pair<Node*, Node*> p = stack.pop();
+            if (p.first->right) {
+                p.second->right = cloneNode(p.first->right, p.second);
+                stack.push(make_pair(p.first->right, p.second->right));
+            }
+            if (p.first->left) {
+                p.second->left = cloneNode(p.first->left, p.second);
+                stack.push(make_pair(p.first->left, p.second->left));
+            }
+        }
+        return newRoot;
+    }
+
+    // 并行辅助：任务划分与合并次序同Tree::reduce，cutoff层以下按先序串行累积（显式栈）
+    template <typename R, typename Map, typename Combine>
+    R reduce(ForkJoinPool& pool, Node* node, R const& identity, Map& map, Combine& combine, int cutoff) const {
+        if (!node) return identity;
+        if (cutoff <= 0) {
+            R acc = identity;
+            Stack<Node*> stack;
+            stack.push(node);
+            while (!stack.empty()) {
+                Node* curr = stack.pop();
+                acc = combine(acc, map(curr->data));
+                if (curr->right) stack.push(curr->right);
+                if (curr->left) stack.push(curr->left);
+            }
+            return acc;
+        }
+        R left = identity, right = identity;
+        pool.join([&] { left = reduce(pool, node->left, identity, map, combine, cutoff - 1); },
+                  [&] { right = reduce(pool, node->right, identity, map, combine, cutoff - 1); });
+        return combine(combine(map(node->data), left), right);
+    }
+
+    Node* copy(ForkJoinPool& pool, Node* node, Node* parent, int cutoff) {
+        if (!node) return NULL;
+        if (cutoff <= 0) return copy(node, parent);
+        Node* newNode = cloneNode(node, parent);
+        pool.join([&] { newNode->left = copy(pool, node->left, newNode, cutoff - 1); },
+                  [&] { newNode->right = copy(pool, node->right, newNode, cutoff - 1); });
+        return newNode;
+    }
+
+    void destroy(ForkJoinPool& pool, Node* node, int cutoff) {
+        if (!node) return;
+        if (cutoff <= 0) { destroy(node); return; }
+        Node* l = node->left;
+        Node* r = node->right;
+        release(node);
+        pool.join([&] { destroy(pool, l, cutoff - 1); }, [&] { destroy(pool, r, cutoff - 1); });
+    }
+
+    // 并行判等：任一任务发现不等即置differ，其余任务随即放弃
+    bool equalTo(ForkJoinPool& pool, Node* a, Node* b, int cutoff, atomic<bool>& differ) const {
+        if (differ.load(memory_order_relaxed)) return false;
+        bool eq;
+        if (!a || !b) eq = (a == b);
+        else if (a->hash != b->hash || a->height != b->height || !(a->data == b->data)) eq = false;
+        else if (cutoff <= 0) eq = equalTo(a, b);
+        else {
+            bool l = true, r = true;
+            pool.join([&] { l = equalTo(pool, a->left, b->left, cutoff - 1, differ); },
+                      [&] { r = equalTo(pool, a->right, b->right, cutoff - 1, differ); });
+            eq = l && r;
+        }
+        if (!eq) differ.store(true, memory_order_relaxed);
+        return eq;
+    }
+
     // 辅助：前/中/后序遍历
     void preOrder(Node* node) const {
         if (node) {
@@ -72,66 +314,69 @@ private:
         }
     }
 
-    // ===== 核心：递归判等（供operator==调用）=====
-    bool equalTo(Node* a, Node* b) const {
-        if (!a && !b) return true;  // 双空相等
-        if (!a || !b) return false; // 一空一非空不等
-        // 节点值相等 + 左子树相等 + 右子树相等
-        return (a->data == b->data) 
-               && equalTo(a->left, b->left) 
-               && equalTo(a->right, b->right);
-    }
-
-    // ===== 核心：递归比较（供operator<调用）=====
-    bool lessThan(Node* a, Node* b) const {
-        // 空树优先级低于非空树
-        if (!a && b) return true;   // a空b非空 → a < b
-        if (a && !b) return false;  // a非空b空 → a > b
-        if (!a && !b) return false; // 双空相等 → a 不小于 b
+    // ===== 核心：判等与比较（供operator==、operator<调用）=====
+    // 二者均为非递归的同步先序遍历：以显式栈成对保存待比较的子树，深度退化的树也不会栈溢出
+    // 两棵树按“先序序列（空子树记为空标记，空小于任何值）”的字典序比较，首个差异即决定结果，只需一趟
+    struct NodePair { Node* a; Node* b; };
 
-        // 1. 先比较当前节点值
-        if (a->data < b->data) return true;
-        if (a->data > b->data) return false;
-
-        // 2. 当前节点值相等，比较左子树
-        if (lessThan(a->left, b->left)) return true;
-        if (lessThan(b->left, a->left)) return false;
-
-        // 3. 左子树相等，比较右子树
-        return lessThan(a->right, b->right);
+    // 判等：eq(x, y)判定两值相等；子树哈希不等者直接判为不等（仅限默认的==，见equalTo(a, b)）
+    template <typename Equal>
+    bool equalTo(Node* a, Node* b, Equal eq, bool byHash) const {
+        Stack<NodePair> stack;
+        NodePair p = { a, b };
+        stack.push(p);
+        while (!stack.empty()) {
+            p = stack.pop();
+            if (!p.a && !p.b) continue;         // 双空相等
+            if (!p.a || !p.b) return false;     // 一空一非空不等
+            if (byHash && p.a->hash != p.b->hash) return false;
+            if (!eq(p.a->data, p.b->data)) return false;
+            NodePair r = { p.a->right, p.b->right }, l = { p.a->left, p.b->left };
+            stack.push(r);
+            stack.push(l); // 左子树先比较
+        }
+        return true;
+    }
+    bool equalTo(Node* a, Node* b) const {
+        return equalTo(a, b, [](T const& x, T const& y) { return x == y; }, true);
     }
 
-    // 扩展：带自定义规则的判等（备用）
+    // 扩展：带自定义规则的判等
     template <typename Equal>
-    bool equalTo(Node* a, Node* b, Equal eq) const {
-        if (!a && !b) return true;
-        if (!a || !b) return false;
-        return eq(a->data, b->data) 
-               && equalTo(a->left, b->left, eq) 
-               && equalTo(a->right, b->right, eq);
-    }
+    bool equalTo(Node* a, Node* b, Equal eq) const { return equalTo(a, b, eq, false); }
 
-    // 扩展：带自定义规则的比较（备用）
+    // 三路比较：a < b返回负数，a > b返回正数，相等返回0；comp(x, y)判定x < y
     template <typename Compare>
-    bool lessThan(Node* a, Node* b, Compare comp) const {
-        if (!a && b) return true;
-        if (a && !b) return false;
-        if (!a && !b) return false;
-
-        if (comp(a->data, b->data)) return true;
-        if (comp(b->data, a->data)) return false;
+    int compare(Node* a, Node* b, Compare comp) const {
+        Stack<NodePair> stack;
+        NodePair p = { a, b };
+        stack.push(p);
+        while (!stack.empty()) {
+            p = stack.pop();
+            if (!p.a && !p.b) continue;     // 双空相等
+            if (!p.a) return -1;            // a空b非空 → a < b
+            if (!p.b) return 1;             // a非空b空 → a > b
+            if (comp(p.a->data, p.b->data)) return -1;
+            if (comp(p.b->data, p.a->data)) return 1;
+            NodePair r = { p.a->right, p.b->right }, l = { p.a->left, p.b->left };
+            stack.push(r);
+            stack.push(l);
+        }
+        return 0;
+    }
+    int compare(Node* a, Node* b) const { return compare(a, b, less<T>()); }
 
-        if (lessThan(a->left, b->left, comp)) return true;
-        if (lessThan(b->left, a->left, comp)) return false;
+    bool lessThan(Node* a, Node* b) const { return compare(a, b) < 0; }
 
-        return lessThan(a->right, b->right, comp);
-    }
+    // 扩展：带自定义规则的比较
+    template <typename Compare>
+    bool lessThan(Node* a, Node* b, Compare comp) const { return compare(a, b, comp) < 0; }
 
 public:
     // 构造/析构/拷贝/赋值
-    BinaryTree() : root(NULL), _size(0) {}
+    BinaryTree() : root(NULL), _size(0), _block(NULL), _blockSize(0) {}
     ~BinaryTree() { clear(); }
-    BinaryTree(BinaryTree<T> const& tree) {
+    BinaryTree(BinaryTree<T> const& tree) : _block(NULL), _blockSize(0) {
         root = copy(tree.root, NULL);
         _size = tree._size;
     }
@@ -148,7 +393,7 @@ public:
     int size() const { return _size; }
     bool empty() const { return _size == 0; }
     void setRoot(T const& e) {
-        if (root) delete root;
+        if (root) release(root);
         root = new Node(e);
         _size = 1;
     }
@@ -158,14 +403,16 @@ public:
             return;
         }
         if (parent->left) {
+            _size -= parent->left->size; // 被替换的整棵子树
             destroy(parent->left);
-            _size--;
         }
         parent->left = new Node(e, NULL, NULL, parent);
         _size++;
         Node* curr = parent;
         while (curr) {
             updateHeight(curr);
+            updateSize(curr);
+            updateHash(curr);
             curr = curr->parent;
         }
     }
@@ -175,30 +422,101 @@ public:
             return;
         }
         if (parent->right) {
+            _size -= parent->right->size; // 被替换的整棵子树
             destroy(parent->right);
-            _size--;
         }
         parent->right = new Node(e, NULL, NULL, parent);
         _size++;
         Node* curr = parent;
         while (curr) {
             updateHeight(curr);
+            updateSize(curr);
+            updateHash(curr);
             curr = curr->parent;
         }
     }
 
+    // ===== 批量构建 =====
+    // 以下构建均替换当前内容：全部节点一次分配于同一节点块，高度与哈希在构建完成后一趟求出，总计O(n)
+    // （逐个addLeft/addRight则每次沿parent链更新至根，共O(n·depth)，链状树即O(n^2)）
+
+    // 由先序与中序序列构建（元素须互异），序列不匹配则报错并返回false（树为空）
+    // 借助栈同步扫描两个序列：栈中为“左子树尚未结束”的节点，栈顶与中序当前元素相等即其左子树结束
+    bool buildFromPreIn(T const* pre, T const* in, int n) {
+        allocBlock(n > 0 ? n : 0);
+        if (n <= 0) { finishBlock(0); return true; }
+        Stack<Node*> stack;
+        stack.push(place(0, pre[0], NULL));
+        int j = 0; // 中序当前位置
+        for (int i = 1; i < n; i++) {
+            Node* parent = NULL;
+            while (!stack.empty() && j < n && stack.peek()->data == in[j]) {
+                parent = stack.pop();
+                j++;
+            }
+            Node* x = place(i, pre[i], parent ? parent : stack.peek());
+            if (parent) parent->right = x;
+            else x->parent->left = x;
+            stack.push(x);
+        }
+        while (!stack.empty() && j < n && stack.peek()->data == in[j]) { stack.pop(); j++; }
+        finishBlock(n);
+        if (j != n || !stack.empty()) { clear(); cerr << "先序与中序序列不匹配，无法构建！" << endl; return false; }
+        return true;
+    }
+
+    // 由层序序列构建：空位以nullMark标记，空节点的（不存在的）孩子不再列出，末尾的空标记可省略
+    void buildFromLevelOrder(T const* level, int n, T const& nullMark) {
+        int count = 0;
+        for (int i = 0; i < n; i++) if (!(level[i] == nullMark)) count++;
+        allocBlock(count);
+        if (n <= 0 || level[0] == nullMark) { finishBlock(0); return; }
+        int k = 0;
+        place(k++, level[0], NULL);
+        int i = 1;
+        for (int q = 0; q < k && i < n; q++) { // 节点块[0, k)即层序队列
+            Node* x = _block + q;
+            if (i < n && !(level[i] == nullMark)) x->left = place(k++, level[i], x);
+            i++;
+            if (i < n && !(level[i] == nullMark)) x->right = place(k++, level[i], x);
+            i++;
+        }
+        finishBlock(k); // 序列中不可达的元素（如空节点之后误列的孩子）被忽略
+    }
+
+    // 由有序数组构建平衡树（各节点左右子树规模至多相差1），可直接用于有序集合模式
+    void buildFromSorted(T const* a, int n) {
+        allocBlock(n > 0 ? n : 0);
+        int k = 0;
+        buildBalanced(a, 0, n > 0 ? n : 0, NULL, k);
+        finishBlock(k);
+    }
+
     // 节点访问
     Node* getRoot() const { return root; }
     Node* getLeft(Node* node) const { return node ? node->left : NULL; }
     Node* getRight(Node* node) const { return node ? node->right : NULL; }
-    T& getData(Node* node) const {
+    T const& getData(Node* node) const { // 只读：修改数据须经setData，以便同步更新哈希
         if (!node) {
             cerr << "节点为空，无法获取数据！" << endl;
             exit(EXIT_FAILURE);
         }
         return node->data;
     }
+    // 修改节点数据，并沿parent链更新各祖先的哈希（有序集合模式下不得借此破坏键的次序）
+    void setData(Node* node, T const& e) {
+        if (!node) {
+            cerr << "节点为空，无法修改数据！" << endl;
+            return;
+        }
+        node->data = e;
+        for (Node* curr = node; curr; curr = curr->parent) updateHash(curr);
+    }
     int getHeight(Node* node) const { return node ? node->height : 0; }
+    int getSize(Node* node) const { return node ? node->size : 0; }
+
+    // 整树的结构哈希（空树为0）：相等的树哈希必相等，供判等快速否决及哈希容器使用
+    size_t hashCode() const { return root ? root->hash : 0; }
 
     // 遍历
     void preOrder() const {
@@ -218,6 +536,7 @@ public:
     }
     void clear() {
         destroy(root);
+        releaseBlock();
         root = NULL;
         _size = 0;
     }
@@ -226,6 +545,7 @@ public:
     bool operator==(const BinaryTree<T>& other) const {
         // 先比较节点数量，数量不等直接返回false（优化）
         if (this->_size != other._size) return false;
+        if (this->hashCode() != other.hashCode()) return false; // 哈希不等则必不等，O(1)
         return equalTo(this->root, other.root);
     }
 
@@ -239,6 +559,102 @@ public:
         return lessThan(this->root, other.root);
     }
 
+    // ===== 线性化比较 =====
+    // 线性化形式：先序序列中的节点/空标记按位打包（节点为1、空为0，共2n + 1位），数据另按先序连续存放
+    // 两棵树的比较归结为两次顺序扫描：标记位每次比较64位，数据（可平凡复制类型）以memcmp整块跳过相同部分
+    // 结果与compare/operator<一致（按T的<比较，空小于任何值），无递归，适于反复比较或极深的树
+    class Serialized {
+        friend class BinaryTree<T>;
+    private:
+        int n;                          // 节点数
+        int nwords;                     // 标记位序列所占64位字数
+        unsigned long long* shape;      // 标记位序列
+        T* data;                        // 先序数据
+
+        Serialized(Serialized const&);            // 禁止复制
+        Serialized& operator=(Serialized const&);
+
+        // 数据中首个按<不等的下标（[0, lim)中无则返回lim），less记录该处是否本方较小
+        int firstDiff(Serialized const& other, int lim, bool& less) const {
+            int i = 0;
+            while (i < lim) {
+                if (is_trivially_copyable<T>::value) { // 按块跳过逐字节相同的部分
+                    int const CHUNK = 64;
+                    while (i + CHUNK <= lim
+                           && memcmp((void const*)(data + i), (void const*)(other.data + i), CHUNK * sizeof(T)) == 0)
+                        i += CHUNK;
+                }
+                int end = (lim - i < 64) ? lim : i + 64;
+                for (; i < end; i++) { // 逐元素确认（字节不同未必不等，如0.0与-0.0）
+                    if (data[i] < other.data[i]) { less = true; return i; }
+                    if (other.data[i] < data[i]) { less = false; return i; }
+                }
+            }
+            return lim;
+        }
+
+    public:
+        Serialized() : n(0), nwords(0), shape(NULL), data(NULL) {}
+        ~Serialized() { delete[] shape; delete[] data; }
+
+        int size() const { return n; }
+
+        // 三路比较：*this < other返回负数，>返回正数，相等返回0
+        int compare(Serialized const& other) const {
+            int w = nwords < other.nwords ? nwords : other.nwords;
+            long long k = -1; // 首个标记位差异的位置（先序序列无前缀关系，故差异必在公共部分内）
+            int c = 0;        // 该位置之前的节点数
+            for (int i = 0; i < w; i++) {
+                unsigned long long x = shape[i] ^ other.shape[i];
+                if (x) {
+                    int b = __builtin_ctzll(x);
+                    k = (long long)i * 64 + b;
+                    c += __builtin_popcountll(shape[i] & ((1ULL << b) - 1));
+                    break;
+                }
+                c += __builtin_popcountll(shape[i]);
+            }
+            if (k < 0 && nwords != other.nwords) k = (long long)w * 64; // 防御：格式损坏时仍有确定结果
+            int lim = k < 0 ? n : c;
+            bool less = false;
+            if (firstDiff(other, lim, less) < lim) return less ? -1 : 1; // 差异节点先于标记差异被访问
+            if (k < 0) return 0;
+            bool mine = (k / 64 < nwords) && ((shape[k / 64] >> (k % 64)) & 1);
+            return mine ? 1 : -1; // 本方为节点而对方为空，则本方大
+        }
+        bool operator==(Serialized const& other) const { return n == other.n && compare(other) == 0; }
+        bool operator!=(Serialized const& other) const { return !(*this == other); }
+        bool operator<(Serialized const& other) const { return compare(other) < 0; }
+    };
+
+    // 线性化：以本树的线性化形式替换s的内容
+    void serialize(Serialized& s) const {
+        delete[] s.shape;
+        delete[] s.data;
+        s.n = _size;
+        s.nwords = (2 * _size + 1 + 63) / 64;
+        s.shape = new unsigned long long[s.nwords]();
+        s.data = new T[_size > 0 ? _size : 1];
+        Stack<Node*> stack;
+        stack.push(root);
+        long long pos = 0;
+        int k = 0;
+        while (!stack.empty()) {
+            Node* x = stack.pop();
+            if (x) {
+                s.shape[pos / 64] |= 1ULL << (pos % 64);
+                s.data[k++] = x->data;
+                stack.push(x->right);
+                stack.push(x->left);
+            }
+            pos++;
+        }
+        s.n = k;
+    }
+
+    // 三路比较（结果同operator<）
+    int compare(BinaryTree<T> const& other) const { return compare(this->root, other.root); }
+
     // 重载其他比较运算符
     bool operator>(const BinaryTree<T>& other) const {
         return other < *this;
@@ -250,6 +666,169 @@ public:
         return !(*this < other);
     }
 
+    // ===== 有序集合模式（AVL）=====
+    // 按T的<组织为二叉搜索树，插入与删除后沿parent链以height驱动单旋/双旋恢复平衡，树高不超过1.44log2(n)
+    // 故insert/erase/find/lowerBound均为O(log n)；元素互异；同一棵树勿与addLeft/addRight混用
+    // 插入：e已存在则返回false
+    bool insert(T const& e) {
+        Node* p = NULL;
+        Node* x = root;
+        while (x) {
+            p = x;
+            if (e < x->data) x = x->left;
+            else if (x->data < e) x = x->right;
+            else return false;
+        }
+        x = new Node(e, NULL, NULL, p);
+        if (!p) root = x;
+        else if (e < p->data) p->left = x;
+        else p->right = x;
+        _size++;
+        rebalance(p);
+        return true;
+    }
+
+    // 删除：e不存在则返回false
+    bool erase(T const& e) {
+        Node* x = find(e);
+        if (!x) return false;
+        if (x->left && x->right) { // 双孩子：与中序后继交换数据，转为删除后继（至多一个右孩子）
+            Node* s = leftmost(x->right);
+            swap(x->data, s->data);
+            x = s;
+        }
+        Node* c = x->left ? x->left : x->right;
+        Node* p = x->parent;
+        replaceChild(p, x, c);
+        release(x);
+        _size--;
+        rebalance(p);
+        return true;
+    }
+
+    // 查找：返回数据等于e的节点，不存在则返回NULL
+    Node* find(T const& e) const {
+        Node* x = root;
+        while (x) {
+            if (e < x->data) x = x->left;
+            else if (x->data < e) x = x->right;
+            else return x;
+        }
+        return NULL;
+    }
+
+    // 返回首个数据不小于e的节点，不存在则返回NULL
+    Node* lowerBound(T const& e) const {
+        Node* x = root;
+        Node* hit = NULL;
+        while (x) {
+            if (x->data < e) x = x->right;
+            else { hit = x; x = x->left; }
+        }
+        return hit;
+    }
+
+    // 中序迭代器（只读，借助parent指针求后继）：for (T const& e : tree) ...
+    class Iterator {
+    private:
+        Node* curr;
+    public:
+        typedef forward_iterator_tag iterator_category; // 元素只读（修改将破坏有序性）
+        typedef T value_type;
+        typedef ptrdiff_t difference_type;
+        typedef T const* pointer;
+        typedef T const& reference;
+
+        explicit Iterator(Node* x = NULL) : curr(x) {}
+        T const& operator*() const { return curr->data; }
+        T const* operator->() const { return &curr->data; }
+        Iterator& operator++() { curr = succ(curr); return *this; }
+        Iterator operator++(int) { Iterator old = *this; ++*this; return old; }
+        bool operator==(Iterator const& it) const { return curr == it.curr; }
+        bool operator!=(Iterator const& it) const { return curr != it.curr; }
+        Node* node() const { return curr; }
+    };
+    Iterator begin() const { return Iterator(leftmost(root)); }
+    Iterator end() const { return Iterator(); }
+    Iterator iteratorAt(Node* x) const { return Iterator(x); } // 例如自lowerBound(e)起迭代
+
+    // ===== 按秩查询（借助子树规模，均为O(depth)；有序集合模式下即O(log n)）=====
+    // 秩即中序序号（自0起）
+    // 中序第k个节点，k越界则返回NULL
+    Node* select(int k) const {
+        if (k < 0 || k >= _size) return NULL;
+        Node* x = root;
+        while (x) {
+            int l = getSize(x->left);
+            if (k < l) x = x->left;
+            else if (k == l) return x;
+            else { k -= l + 1; x = x->right; }
+        }
+        return NULL;
+    }
+
+    // 节点x的秩：其左子树规模，加上沿parent链向上时每个“x在其右子树中”的祖先及其左子树
+    int rank(Node* x) const {
+        int r = getSize(x->left);
+        for (Node* p = x->parent; p; x = p, p = p->parent)
+            if (p->right == x) r += getSize(p->left) + 1;
+        return r;
+    }
+
+    // 中序位于节点a、b之间（含两端，a不后于b）的节点数
+    int countBetween(Node* a, Node* b) const { return rank(b) - rank(a) + 1; }
+
+    // 有序集合模式：小于e的元素数（即lowerBound(e)的秩），及落在[lo, hi)中的元素数
+    int countLess(T const& e) const {
+        int r = 0;
+        for (Node* x = root; x; ) {
+            if (x->data < e) { r += getSize(x->left) + 1; x = x->right; }
+            else x = x->left;
+        }
+        return r;
+    }
+    int countRange(T const& lo, T const& hi) const {
+        int r = countLess(hi) - countLess(lo);
+        return r > 0 ? r : 0;
+    }
+
+    // 自秩k起的中序迭代器（定位O(depth)，此后每步均摊O(1)），无需从头扫描
+    Iterator iteratorAtRank(int k) const { return Iterator(select(k)); }
+
+    // 并行操作：用法与cutoff的取值同Tree.h
+    // 并行归约：各节点先取map(data)，再以combine合并（须满足结合律，identity为单位元）
+    template <typename R, typename Map, typename Combine>
+    R parallelReduce(ForkJoinPool& pool, R identity, Map map, Combine combine, int cutoff = 8) const {
+        R r = identity;
+        pool.invoke([&] { r = reduce(pool, root, identity, map, combine, cutoff); });
+        return r;
+    }
+
+    // 并行复制：以tree的副本替换当前树
+    void parallelCopy(BinaryTree<T> const& tree, ForkJoinPool& pool, int cutoff = 8) {
+        if (this == &tree) return;
+        parallelClear(pool, cutoff);
+        pool.invoke([&] { root = copy(pool, tree.root, NULL, cutoff); });
+        _size = tree._size;
+    }
+
+    // 并行清空
+    void parallelClear(ForkJoinPool& pool, int cutoff = 8) {
+        pool.invoke([&] { destroy(pool, root, cutoff); });
+        releaseBlock();
+        root = NULL;
+        _size = 0;
+    }
+
+    // 并行判等（结果同operator==）
+    bool parallelEquals(BinaryTree<T> const& other, ForkJoinPool& pool, int cutoff = 8) const {
+        if (this->_size != other._size || this->hashCode() != other.hashCode()) return false;
+        atomic<bool> differ(false);
+        bool eq = true;
+        pool.invoke([&] { eq = equalTo(pool, this->root, other.root, cutoff, differ); });
+        return eq;
+    }
+
     // 自定义判等（例如：忽略整数绝对值、字符串大小写）
     template <typename Equal>
     bool equals(const BinaryTree<T>& other, Equal eq) const {
@@ -264,4 +843,11 @@ public:
     }
 };
 
+// 使BinaryTree可作为unordered_set/unordered_map的键
+namespace std {
+template <typename T> struct hash<BinaryTree<T> > {
+    size_t operator()(BinaryTree<T> const& tree) const { return tree.hashCode(); }
+};
+}
+
 #endif  // BINARY_TREE_H
\ No newline at end of file
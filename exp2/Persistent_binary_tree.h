@@ -0,0 +1,233 @@
+#ifndef PERSISTENT_BINARY_TREE_H
+#define PERSISTENT_BINARY_TREE_H
+#include <iostream>
+#include <cstdlib>
+#include <algorithm>
+#include <atomic>
+#include "../exp1/Stack.h" // 复用exp1的顺序栈（exp1须与exp2同处一个父目录）
+using namespace std;
+
+// 持久化二叉树：节点一经创建即不再修改，并以引用计数在多个版本间共享
+// 复制（快照）只复制根指针并增加其引用计数，O(1)；修改时仅复制自根至修改处的路径（路径复制），
+// 其余子树原样共享，故每次修改为O(depth)时间与空间，旧版本（快照）不受影响
+// 节点可能同时属于多个版本，故不设parent指针；修改位置以自根出发的路径表示：'L'为左、'R'为右，""即根
+// 引用计数为原子变量：不同线程可各自持有、修改、释放共享节点的不同版本（同一版本对象的并发修改仍须自行同步）
+template <typename T> class PersistentBinaryTree {
+public:
+    struct Node {
+        T data;
+        int height;
+        int size;                    // 子树规模
+        Node const* left;
+        Node const* right;
+        mutable atomic<int> refs;    // 引用计数（父节点与各版本的根均计入）
+
+        Node(T const& e, Node const* l = NULL, Node const* r = NULL)
+            : data(e), height(1), size(1), left(l), right(r), refs(1) {
+            if (l) { l->refs.fetch_add(1, memory_order_relaxed); size += l->size; }
+            if (r) { r->refs.fetch_add(1, memory_order_relaxed); size += r->size; }
+            height = max(l ? l->height : 0, r ? r->height : 0) + 1;
+        }
+    };
+
+private:
+    Node const* root;
+
+    static void retain(Node const* node) {
+        if (node) node->refs.fetch_add(1, memory_order_relaxed);
+    }
+
+    // 释放一个引用：计数归零则删除节点，并继续释放其孩子（以栈代替递归）
+    // 先递减计数，仅当确有节点须删除时才用到栈；栈中只存放计数已归零、待删除的节点
+    static void release(Node const* node) {
+        if (!node || node->refs.fetch_sub(1, memory_order_acq_rel) != 1) return; // 仍被共享（最常见）
+        Stack<Node const*> stack;
+        stack.push(node);
+        while (!stack.empty()) {
+            Node const* x = stack.pop();
+            if (x->left && x->left->refs.fetch_sub(1, memory_order_acq_rel) == 1) stack.push(x->left);
+            if (x->right && x->right->refs.fetch_sub(1, memory_order_acq_rel) == 1) stack.push(x->right);
+            delete x;
+        }
+    }
+
+    // 沿路径自根向下，将途经节点依次压入stack（不含空位）；路径无效则返回false
+    bool descend(char const* path, Stack<Node const*>& stack) const {
+        Node const* x = root;
+        for (char const* p = path; ; p++) {
+            if (!x) return false;
+            stack.push(x);
+            if (!*p) return true;
+            if (*p == 'L') x = x->left;
+            else if (*p == 'R') x = x->right;
+            else return false;
+        }
+    }
+
+    // 路径复制：stack中为自根至修改处父亲的原节点，copy为修改处的新节点（已持有一个引用）
+    // 自下而上为每个原节点创建副本，以下层的副本替换相应的孩子；返回新根（原节点均不受影响）
+    static Node const* copyPath(Stack<Node const*>& stack, char const* path, Node const* copy) {
+        int depth = stack.size(); // path[0, depth)为自根至修改处的方向
+        while (!stack.empty()) {
+            Node const* p = stack.pop();
+            Node const* c = (path[--depth] == 'L') ? new Node(p->data, copy, p->right) : new Node(p->data, p->left, copy);
+            release(copy); // 副本构造时已增加引用，此处交出构造方持有的那一个
+            copy = c;
+        }
+        return copy;
+    }
+
+    // 以newNode（由x的数据或孩子改造而来）取代path所指节点x，生成新版本
+    void commit(Stack<Node const*>& stack, char const* path, Node const* newNode) {
+        Node const* newRoot = copyPath(stack, path, newNode);
+        release(root);
+        root = newRoot;
+    }
+
+    bool add(char const* path, T const& e, bool left) {
+        Stack<Node const*> stack;
+        if (!descend(path, stack)) {
+            cerr << "路径无效，无法添加" << (left ? "左" : "右") << "子节点！" << endl;
+            return false;
+        }
+        Node const* x = stack.pop();
+        Node const* leaf = new Node(e);
+        Node const* y = left ? new Node(x->data, leaf, x->right) : new Node(x->data, x->left, leaf); // 原有的同侧子树被替换
+        release(leaf);
+        commit(stack, path, y);
+        return true;
+    }
+
+    // 辅助：前/中/后序遍历（显式栈）
+    static void preOrder(Node const* node) {
+        Stack<Node const*> stack;
+        if (node) stack.push(node);
+        while (!stack.empty()) {
+            Node const* x = stack.pop();
+            cout << x->data << " ";
+            if (x->right) stack.push(x->right);
+            if (x->left) stack.push(x->left);
+        }
+    }
+    static void inOrder(Node const* node) {
+        Stack<Node const*> stack;
+        Node const* x = node;
+        while (!stack.empty() || x) {
+            while (x) { stack.push(x); x = x->left; }
+            x = stack.pop();
+            cout << x->data << " ";
+            x = x->right;
+        }
+    }
+    static void postOrder(Node const* node) {
+        Stack<Node const*> stack;
+        Node const* x = node;
+        Node const* last = NULL;
+        while (!stack.empty() || x) {
+            while (x) { stack.push(x); x = x->left; }
+            Node const* top = stack.peek();
+            if (top->right && top->right != last) x = top->right;
+            else { stack.pop(); cout << top->data << " "; last = top; }
+        }
+    }
+
+    // 判等：共享的子树（同一节点）直接判为相等，故比较一个版本与其快照只需访问被修改的路径
+    static bool equalTo(Node const* a, Node const* b) {
+        Stack<Node const*> stack;
+        stack.push(a);
+        stack.push(b);
+        while (!stack.empty()) {
+            Node const* y = stack.pop();
+            Node const* x = stack.pop();
+            if (x == y) continue;
+            if (!x || !y) return false;
+            if (x->size != y->size || x->height != y->height || !(x->data == y->data)) return false;
+            stack.push(x->right); stack.push(y->right);
+            stack.push(x->left); stack.push(y->left);
+        }
+        return true;
+    }
+
+public:
+    // 构造/析构/拷贝/赋值：拷贝与赋值均只共享根，O(1)
+    PersistentBinaryTree() : root(NULL) {}
+    ~PersistentBinaryTree() { release(root); }
+    PersistentBinaryTree(PersistentBinaryTree<T> const& tree) : root(tree.root) { retain(root); }
+    PersistentBinaryTree<T>& operator=(PersistentBinaryTree<T> const& tree) {
+        retain(tree.root); // 先增后减，自赋值亦安全
+        release(root);
+        root = tree.root;
+        return *this;
+    }
+
+    // 快照：当前版本的O(1)副本，此后双方的修改互不影响
+    PersistentBinaryTree<T> snapshot() const { return *this; }
+
+    // 基础操作
+    int size() const { return root ? root->size : 0; }
+    bool empty() const { return !root; }
+    void setRoot(T const& e) { // 以单节点树替换当前版本
+        release(root);
+        root = new Node(e);
+    }
+    void clear() {
+        release(root);
+        root = NULL;
+    }
+
+    // 在path所指节点处添加左（右）子节点（原有的同侧子树在新版本中被替换），O(depth)
+    bool addLeft(char const* path, T const& e) { return add(path, e, true); }
+    bool addRight(char const* path, T const& e) { return add(path, e, false); }
+
+    // 修改path所指节点的数据，O(depth)
+    bool setData(char const* path, T const& e) {
+        Stack<Node const*> stack;
+        if (!descend(path, stack)) {
+            cerr << "路径无效，无法修改数据！" << endl;
+            return false;
+        }
+        Node const* x = stack.pop();
+        commit(stack, path, new Node(e, x->left, x->right));
+        return true;
+    }
+
+    // 节点访问（节点只读）
+    Node const* getRoot() const { return root; }
+    Node const* getLeft(Node const* node) const { return node ? node->left : NULL; }
+    Node const* getRight(Node const* node) const { return node ? node->right : NULL; }
+    T const& getData(Node const* node) const {
+        if (!node) {
+            cerr << "节点为空，无法获取数据！" << endl;
+            exit(EXIT_FAILURE);
+        }
+        return node->data;
+    }
+    int getHeight(Node const* node) const { return node ? node->height : 0; }
+    Node const* find(char const* path) const { // path所指节点，无效则返回NULL
+        Stack<Node const*> stack;
+        return descend(path, stack) ? stack.peek() : NULL;
+    }
+
+    // 遍历
+    void preOrder() const {
+        cout << "前序遍历: ";
+        preOrder(root);
+        cout << endl;
+    }
+    void inOrder() const {
+        cout << "中序遍历: ";
+        inOrder(root);
+        cout << endl;
+    }
+    void postOrder() const {
+        cout << "后序遍历: ";
+        postOrder(root);
+        cout << endl;
+    }
+
+    // 判等器
+    bool operator==(PersistentBinaryTree<T> const& other) const { return equalTo(root, other.root); }
+    bool operator!=(PersistentBinaryTree<T> const& other) const { return !(*this == other); }
+};
+
+#endif  // PERSISTENT_BINARY_TREE_H
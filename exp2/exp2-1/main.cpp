@@ -0,0 +1,244 @@
+// 查找树性能对比：同一组键上比较不同实现的插入/查找耗时，并核对结果一致
+// 编译：g++ -std=c++11 -O2 -pthread main.cpp（Binary_tree.h引入了exp1的线程池）
+#include <iostream>
+#include <cstdlib>
+#include <chrono>
+#include <map>
+#include <algorithm>
+#include "../Binary_tree.h"
+#include "../B_tree.h"
+
+using namespace std;
+
+// 校验失败即报错退出
+void check(bool ok, char const* what) {
+    if (!ok) {
+        cerr << "校验失败：" << what << endl;
+        exit(EXIT_FAILURE);
+    }
+}
+
+// 计时：返回f执行的毫秒数
+template <typename F> double timeMs(F f) {
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+// ===== AVL树 vs 不平衡的二叉搜索树 =====
+
+// 不平衡的二叉搜索树（对照组）：按插入次序直接挂接，不做旋转；插入/查找均为迭代，链状时也不致栈溢出
+template <typename T> class UnbalancedBST {
+private:
+    struct Node {
+        T data;
+        Node* left;
+        Node* right;
+
+        Node(T const& e) : data(e), left(NULL), right(NULL) {}
+    };
+
+    Node* root;
+    int _height;
+
+public:
+    UnbalancedBST() : root(NULL), _height(0) {}
+    ~UnbalancedBST() {
+        Stack<Node*> stack;
+        if (root) stack.push(root);
+        while (!stack.empty()) {
+            Node* x = stack.pop();
+            if (x->left) stack.push(x->left);
+            if (x->right) stack.push(x->right);
+            delete x;
+        }
+    }
+
+    int height() const { return _height; }
+    bool insert(T const& e) {
+        Node** link = &root;
+        int depth = 1;
+        while (*link) {
+            if (e < (*link)->data) link = &(*link)->left;
+            else if ((*link)->data < e) link = &(*link)->right;
+            else return false;
+            depth++;
+        }
+        *link = new Node(e);
+        if (depth > _height) _height = depth;
+        return true;
+    }
+    bool contains(T const& e) const {
+        Node* x = root;
+        while (x && !(x->data == e)) x = (e < x->data) ? x->left : x->right;
+        return x != NULL;
+    }
+};
+
+// 插入keys[0, n)后逐个查找，再查找n个不存在的键；返回找到的个数
+template <typename Tree, typename Find> int treeWorkload(Tree& tree, int const* keys, int n, Find find) {
+    for (int i = 0; i < n; i++) tree.insert(keys[i]);
+    int found = 0;
+    for (int i = 0; i < n; i++) found += find(tree, keys[i]) ? 1 : 0;
+    for (int i = 0; i < n; i++) found += find(tree, -keys[i] - 1) ? 1 : 0; // 键均非负，故均不存在
+    return found;
+}
+
+// 随机键与递增键（不平衡树退化为链）两种插入次序下比较
+void benchAvl(int n) {
+    int* random = new int[n];
+    int* ascending = new int[n];
+    srand(3);
+    for (int i = 0; i < n; i++) {
+        random[i] = (int)(((long long)rand() * 65536 + rand()) % 1000000000);
+        ascending[i] = i;
+    }
+    char const* names[] = {"随机次序", "递增次序"};
+    int* inputs[] = {random, ascending};
+    cout << "AVL树 vs 不平衡树（" << n << " 个键，插入后各查找 " << 2 * n << " 次）:" << endl;
+    for (int k = 0; k < 2; k++) {
+        BinaryTree<int> avl;
+        UnbalancedBST<int> plain;
+        int a = 0, b = 0;
+        double avlMs = timeMs([&] {
+            a = treeWorkload(avl, inputs[k], n, [](BinaryTree<int> const& t, int e) { return t.find(e) != NULL; });
+        });
+        double plainMs = timeMs([&] {
+            b = treeWorkload(plain, inputs[k], n, [](UnbalancedBST<int> const& t, int e) { return t.contains(e); });
+        });
+        check(a == b, "两种树的查找结果不一致");
+        cout << "  " << names[k] << ": AVL " << avlMs << " ms（高度 " << avl.getHeight(avl.getRoot())
+             << "）, 不平衡 " << plainMs << " ms（高度 " << plain.height() << "）" << endl;
+    }
+    delete[] random;
+    delete[] ascending;
+}
+
+// ===== B+树 vs std::map vs AVL树 =====
+
+// 三种实现的统一接口：插入、查找、顺序遍历（返回键和）、区间[lo, hi)扫描（返回键和）
+struct BTreeOps {
+    BTree<int, int> t;
+    void insert(int k, int v) { t.insert(k, v); }
+    bool contains(int k) const { return t.contains(k); }
+    long long scan() const {
+        long long s = 0;
+        for (BTree<int, int>::ConstIterator it = t.begin(); it != t.end(); ++it) s += it.key();
+        return s;
+    }
+    long long range(int lo, int hi) const {
+        long long s = 0;
+        t.range(lo, hi, [&](int const& k, int const&) { s += k; });
+        return s;
+    }
+    int size() const { return t.size(); }
+};
+struct MapOps {
+    map<int, int> t;
+    void insert(int k, int v) { t[k] = v; }
+    bool contains(int k) const { return t.count(k) != 0; }
+    long long scan() const {
+        long long s = 0;
+        for (map<int, int>::const_iterator it = t.begin(); it != t.end(); ++it) s += it->first;
+        return s;
+    }
+    long long range(int lo, int hi) const {
+        long long s = 0;
+        for (map<int, int>::const_iterator it = t.lower_bound(lo); it != t.end() && it->first < hi; ++it) s += it->first;
+        return s;
+    }
+    int size() const { return (int)t.size(); }
+};
+struct AvlOps {
+    BinaryTree<int> t;
+    void insert(int k, int) { t.insert(k); }
+    bool contains(int k) const { return t.find(k) != NULL; }
+    long long scan() const {
+        long long s = 0;
+        for (BinaryTree<int>::Iterator it = t.begin(); it != t.end(); ++it) s += *it;
+        return s;
+    }
+    long long range(int lo, int hi) const {
+        long long s = 0;
+        for (BinaryTree<int>::Iterator it = t.iteratorAt(t.lowerBound(lo)); it != t.end() && *it < hi; ++it) s += *it;
+        return s;
+    }
+    int size() const { return t.size(); }
+};
+
+// 各阶段分别计时：插入n个键；n次命中与n次未命中查找；顺序遍历；q次宽为width的区间扫描
+// ms[0..3]与r[0..3]依次为各阶段的耗时与校验和
+template <typename Ops> void treePhases(Ops& ops, int const* keys, int n, int const* los, int q, int width,
+                                        double* ms, long long* r) {
+    ms[0] = timeMs([&] { for (int i = 0; i < n; i++) ops.insert(keys[i], i); });
+    r[0] = ops.size();
+    r[1] = 0;
+    ms[1] = timeMs([&] { for (int i = 0; i < n; i++) r[1] += ops.contains(keys[i]) + ops.contains(-keys[i] - 1); });
+    ms[2] = timeMs([&] { r[2] = ops.scan(); });
+    r[3] = 0;
+    ms[3] = timeMs([&] { for (int i = 0; i < q; i++) r[3] += ops.range(los[i], los[i] + width); });
+}
+
+// 随机插入n个键（取自[0, 1e9)）后分阶段比较；区间扫描各约覆盖64个键；另测有序键的批量构建
+// baselines为false时只测B+树：std::map与AVL树每个节点约48~64字节（B+树每个键约12字节），
+// 1亿个键时二者合计需约10GB，超出本实验环境的内存（5GB）
+void benchBTree(int n, bool baselines) {
+    int* keys = new int[n];
+    srand(4);
+    for (int i = 0; i < n; i++) keys[i] = (int)(((long long)rand() * 65536 + rand()) % 1000000000);
+    int q = n / 10 < 100000 ? n / 10 : 100000;
+    int width = (int)(64 * 1000000000LL / n);
+    int* los = new int[q];
+    for (int i = 0; i < q; i++) los[i] = (int)(((long long)rand() * 65536 + rand()) % (1000000000 - width));
+    cout << "B+树" << (baselines ? " vs std::map vs AVL树" : "") << "（" << n << " 个随机键）:" << endl;
+
+    char const* phases[] = {"插入", "查找（命中+未命中）", "顺序遍历", "区间扫描"};
+    char const* names[] = {"B+树", "std::map", "AVL树"};
+    double ms[3][4];
+    long long r[3][4];
+    int height;
+    {
+        BTreeOps b;
+        treePhases(b, keys, n, los, q, width, ms[0], r[0]);
+        height = b.t.height();
+    }
+    if (baselines) {
+        { MapOps m; treePhases(m, keys, n, los, q, width, ms[1], r[1]); }
+        { AvlOps a; treePhases(a, keys, n, los, q, width, ms[2], r[2]); }
+        for (int k = 0; k < 4; k++) check(r[0][k] == r[1][k] && r[1][k] == r[2][k], "各实现的规模/查找/遍历结果不一致");
+    }
+    for (int k = 0; k < 4; k++) {
+        cout << "  " << phases[k];
+        if (k == 3) cout << "（" << q << " 次，每次约 " << (r[0][0] ? (double)width * r[0][0] / 1000000000 : 0) << " 个键）";
+        cout << ":";
+        for (int j = 0; j < (baselines ? 3 : 1); j++) cout << (j ? ", " : " ") << names[j] << " " << ms[j][k] << " ms";
+        cout << endl;
+    }
+    cout << "  B+树高度 " << height << endl;
+    delete[] los;
+
+    sort(keys, keys + n);
+    int m = (int)(unique(keys, keys + n) - keys); // 已去重的有序键
+    Vector<int> sortedKeys(m, m, 0), values(m, m, 0);
+    for (int i = 0; i < m; i++) {
+        sortedKeys[i] = keys[i];
+        values[i] = i;
+    }
+    delete[] keys;
+    BTree<int, int> loaded;
+    double loadMs = timeMs([&] { check(loaded.bulkLoad(sortedKeys, values), "批量构建失败"); });
+    for (int i = 0; i < m; i += 97) check(*loaded.find(sortedKeys[i]) == i, "批量构建后查找结果不符");
+    cout << "  B+树批量构建 " << m << " 个有序键: " << loadMs << " ms（高度 " << loaded.height() << "）" << endl;
+}
+
+int main() {
+    cout << "=== AVL树 ===" << endl;
+    benchAvl(20000);
+
+    cout << "\n=== B+树 ===" << endl;
+    benchBTree(1000000, true);
+    benchBTree(10000000, true);
+    benchBTree(100000000, false);
+
+    return 0;
+}